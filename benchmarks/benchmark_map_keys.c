@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "argus.h"
+
+// Measures the cost of loading many "-D key=value" pairs into a map option,
+// then of reading every key back with argus_map_get. With the hashed key
+// index the time per pair should stay flat as the number of keys grows.
+
+#define PAIR_SIZE 48
+
+ARGUS_OPTIONS(
+    options,
+    OPTION_MAP_STRING('D', "define", HELP("Definitions")),
+)
+
+// Builds "-D key=value" pairs, each key repeated twice so updates are measured too
+static char **generate_argv(int pairs, int *argc)
+{
+    *argc      = 1 + pairs * 2 * 2;
+    char **argv = calloc(*argc + 1, sizeof(char *));
+    if (!argv) {
+        fprintf(stderr, "Allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    argv[0] = "benchmark";
+    for (int i = 0; i < pairs * 2; i++) {
+        argv[1 + i * 2] = "-D";
+        argv[2 + i * 2] = malloc(PAIR_SIZE);
+        if (!argv[2 + i * 2]) {
+            fprintf(stderr, "Allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        snprintf(argv[2 + i * 2], PAIR_SIZE, "key.%07d=value%d", i % pairs, i);
+    }
+    return argv;
+}
+
+static void free_argv(char **argv, int argc)
+{
+    for (int i = 2; i < argc; i += 2)
+        free(argv[i]);
+    free(argv);
+}
+
+static void measure(char **argv, int argc, int pairs, double *parse_time, double *get_time)
+{
+    char    key[PAIR_SIZE];
+    argus_t argus = argus_init(options, "benchmark", "1.0.0");
+
+    clock_t start = clock();
+    if (argus_parse(&argus, argc, argv) != ARGUS_SUCCESS) {
+        fprintf(stderr, "Parsing failed\n");
+        exit(EXIT_FAILURE);
+    }
+    clock_t parsed = clock();
+
+    for (int i = 0; i < pairs; i++) {
+        snprintf(key, sizeof(key), "key.%07d", i);
+        if (argus_map_get(&argus, "define", key).as_string == NULL) {
+            fprintf(stderr, "Missing key '%s'\n", key);
+            exit(EXIT_FAILURE);
+        }
+    }
+    clock_t end = clock();
+
+    *parse_time = ((double)(parsed - start)) / CLOCKS_PER_SEC;
+    *get_time   = ((double)(end - parsed)) / CLOCKS_PER_SEC;
+    argus_free(&argus);
+}
+
+int main(void)
+{
+    const int pair_counts[] = {100, 1000, 10000, 50000};
+
+    printf("=== ARGUS MAP KEY BENCHMARK ===\n\n");
+    printf("Each key is given twice, then read back once\n\n");
+    printf("%-10s | %-12s | %-14s | %-14s\n", "Keys", "Parse (s)", "ns / pair", "ns / get");
+    printf("------------------------------------------------------------\n");
+
+    for (size_t i = 0; i < sizeof(pair_counts) / sizeof(pair_counts[0]); i++) {
+        int    argc;
+        char **argv = generate_argv(pair_counts[i], &argc);
+        double parse_time;
+        double get_time;
+
+        measure(argv, argc, pair_counts[i], &parse_time, &get_time);
+        printf("%-10d | %-12.6f | %-14.1f | %-14.1f\n", pair_counts[i], parse_time,
+               parse_time * 1e9 / (pair_counts[i] * 2.0), get_time * 1e9 / pair_counts[i]);
+
+        free_argv(argv, argc);
+    }
+    printf("============================================================\n");
+    return 0;
+}
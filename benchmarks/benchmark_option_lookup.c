@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "argus.h"
+
+// Measures the cost of resolving long options as the number of declared
+// options grows. With the hashed long-name index the time per token should
+// stay flat instead of growing with the option count.
+
+#define NAME_SIZE 48
+
+typedef struct
+{
+    argus_option_t *options;
+    char          (*names)[NAME_SIZE];
+    size_t          count;
+} generated_options_t;
+
+static generated_options_t generate_options(size_t count)
+{
+    generated_options_t gen = {0};
+
+    gen.count   = count;
+    gen.options = calloc(count + 1, sizeof(argus_option_t));
+    gen.names   = calloc(count, NAME_SIZE);
+    if (!gen.options || !gen.names) {
+        fprintf(stderr, "Allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        snprintf(gen.names[i], NAME_SIZE, "generated-flag-%05zu", i);
+        gen.options[i] = OPTION_FLAG('\0', gen.names[i], HELP("Generated flag"));
+    }
+    gen.options[count] = OPTION_END();
+    return gen;
+}
+
+static void free_generated_options(generated_options_t *gen)
+{
+    free(gen->options);
+    free(gen->names);
+}
+
+// Builds an argv that references options spread over the whole table,
+// so that a linear scan would have to walk half of it on average.
+static char **generate_argv(const generated_options_t *gen, int tokens)
+{
+    char **argv = calloc(tokens + 1, sizeof(char *));
+    if (!argv) {
+        fprintf(stderr, "Allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    argv[0] = "benchmark";
+    for (int i = 1; i <= tokens; i++) {
+        size_t target = ((size_t)i * 7919) % gen->count;
+        argv[i]       = malloc(NAME_SIZE + 2);
+        if (!argv[i]) {
+            fprintf(stderr, "Allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        snprintf(argv[i], NAME_SIZE + 2, "--%s", gen->names[target]);
+    }
+    return argv;
+}
+
+static void free_argv(char **argv, int tokens)
+{
+    for (int i = 1; i <= tokens; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+static double measure_parse_time(generated_options_t *gen, char **argv, int tokens,
+                                 int iterations)
+{
+    clock_t start = clock();
+
+    for (int i = 0; i < iterations; i++) {
+        argus_t argus = argus_init(gen->options, "benchmark", "1.0.0");
+        if (argus_parse(&argus, tokens + 1, argv) != ARGUS_SUCCESS) {
+            fprintf(stderr, "Parsing failed\n");
+            exit(EXIT_FAILURE);
+        }
+        argus_free(&argus);
+    }
+
+    clock_t end = clock();
+    return ((double)(end - start)) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    const size_t option_counts[] = {10, 50, 100, 400, 1000, 4000};
+    const int    tokens          = 2000;
+    const int    iterations      = 50;
+
+    printf("=== ARGUS LONG OPTION LOOKUP BENCHMARK ===\n\n");
+    printf("%d tokens per parse, %d parses per measurement\n\n", tokens, iterations);
+    printf("%-10s | %-14s | %-14s\n", "Options", "Total (s)", "ns / token");
+    printf("------------------------------------------\n");
+
+    for (size_t i = 0; i < sizeof(option_counts) / sizeof(option_counts[0]); i++) {
+        generated_options_t gen  = generate_options(option_counts[i]);
+        char              **argv = generate_argv(&gen, tokens);
+
+        // Warm-up
+        measure_parse_time(&gen, argv, tokens, 2);
+
+        double total     = measure_parse_time(&gen, argv, tokens, iterations);
+        double per_token = total * 1e9 / ((double)tokens * iterations);
+        printf("%-10zu | %-14.6f | %-14.1f\n", option_counts[i], total, per_token);
+
+        free_argv(argv, tokens);
+        free_generated_options(&gen);
+    }
+    printf("==========================================\n");
+    return 0;
+}
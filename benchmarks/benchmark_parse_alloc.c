@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "argus.h"
+
+// Measures the heap traffic of parsing multi-value options. Each value of an
+// array or a map is copied, so parsing into the context arena should cut the
+// number of allocations per parse down to a handful once the arena is warm.
+
+#if defined(__GLIBC__)
+    #define HAVE_ALLOCATION_COUNTER 1
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static size_t allocation_count = 0;
+
+// Every allocation of the process, the library included, goes through these
+void *malloc(size_t size)
+{
+    allocation_count++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    allocation_count++;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    allocation_count++;
+    return __libc_realloc(ptr, size);
+}
+#else
+    #define HAVE_ALLOCATION_COUNTER 0
+static size_t allocation_count = 0;
+#endif
+
+ARGUS_OPTIONS(
+    alloc_options,
+    OPTION_ARRAY_STRING('I', "include", HELP("Include directories")),
+    OPTION_ARRAY_INT('p', "ports", HELP("Port numbers")),
+    OPTION_MAP_STRING('D', "define", HELP("Define variables")),
+    POSITIONAL_MANY_STRING("files", HELP("Input files")),
+)
+
+typedef enum
+{
+    MODE_HEAP,
+    MODE_HEAP_RESET,
+    MODE_ARENA_RESET,
+} parse_mode_t;
+
+static char **generate_argv(int values, int *argc)
+{
+    char **argv = calloc((size_t)values * 4 + 1, sizeof(char *));
+    if (!argv) {
+        fprintf(stderr, "Allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int n     = 0;
+    argv[n++] = "benchmark";
+    for (int i = 0; i < values; i++) {
+        char buffer[64];
+
+        snprintf(buffer, sizeof(buffer), "--include=/usr/include/dir%d,/opt/include/dir%d", i, i);
+        argv[n++] = strdup(buffer);
+        snprintf(buffer, sizeof(buffer), "--ports=%d,%d", 1000 + i, 2000 + i);
+        argv[n++] = strdup(buffer);
+        snprintf(buffer, sizeof(buffer), "-DNAME_%d=value_%d", i, i);
+        argv[n++] = strdup(buffer);
+    }
+    for (int i = 0; i < values; i++) {
+        char buffer[64];
+
+        snprintf(buffer, sizeof(buffer), "src/file_%d.c", i);
+        argv[n++] = strdup(buffer);
+    }
+    *argc = n;
+    return argv;
+}
+
+static void free_argv(char **argv, int argc)
+{
+    for (int i = 1; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+static void parse_or_exit(argus_t *argus, int argc, char **argv)
+{
+    if (argus_parse(argus, argc, argv) != ARGUS_SUCCESS) {
+        fprintf(stderr, "Parsing failed\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static double measure(parse_mode_t mode, int argc, char **argv, int iterations,
+                      double *allocations)
+{
+    argus_t argus = argus_init(alloc_options, "benchmark", "1.0.0");
+    if (mode == MODE_ARENA_RESET)
+        argus_use_arena(&argus, 0);
+
+    // Warm-up: let the reused buffers and the arena reach their final size
+    parse_or_exit(&argus, argc, argv);
+    if (mode == MODE_HEAP)
+        argus_free(&argus);
+    else
+        argus_reset(&argus);
+
+    size_t  start_count = allocation_count;
+    clock_t start       = clock();
+    for (int i = 0; i < iterations; i++) {
+        if (mode == MODE_HEAP)
+            argus = argus_init(alloc_options, "benchmark", "1.0.0");
+        parse_or_exit(&argus, argc, argv);
+        if (mode == MODE_HEAP)
+            argus_free(&argus);
+        else
+            argus_reset(&argus);
+    }
+    clock_t end = clock();
+
+    *allocations = (double)(allocation_count - start_count) / iterations;
+    if (mode != MODE_HEAP)
+        argus_free(&argus);
+    return ((double)(end - start)) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    const int   value_counts[] = {10, 100, 1000};
+    const int   iterations     = 200;
+    const char *mode_names[]   = {"heap", "heap + reset", "arena + reset"};
+
+    printf("=== ARGUS PARSE ALLOCATION BENCHMARK ===\n\n");
+    printf("%d parses per measurement", iterations);
+    if (!HAVE_ALLOCATION_COUNTER)
+        printf(" (allocation counter needs glibc)");
+    printf("\n\n");
+    printf("%-8s | %-14s | %-12s | %-14s\n", "Values", "Mode", "us / parse", "allocs / parse");
+    printf("--------------------------------------------------------------\n");
+
+    for (size_t i = 0; i < sizeof(value_counts) / sizeof(value_counts[0]); i++) {
+        int    argc;
+        char **argv = generate_argv(value_counts[i], &argc);
+
+        for (int mode = MODE_HEAP; mode <= MODE_ARENA_RESET; mode++) {
+            double allocations;
+            double total = measure((parse_mode_t)mode, argc, argv, iterations, &allocations);
+            printf("%-8d | %-14s | %-12.2f | %-14.1f\n", value_counts[i], mode_names[mode],
+                   total * 1e6 / iterations, allocations);
+        }
+        free_argv(argv, argc);
+    }
+    printf("==============================================================\n");
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "argus.h"
+#include "argus/regex.h"
+
+// Measures V_REGEX on large variadic positionals. Every value is checked
+// against the same pattern: it is compiled once per context, so the time
+// per value should stay flat as the number of values grows.
+
+#define VALUE_SIZE 48
+
+static char **generate_argv(size_t count, bool emails)
+{
+    char **argv = calloc(count + 2, sizeof(char *));
+    if (!argv) {
+        fprintf(stderr, "Allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    argv[0] = "benchmark";
+    for (size_t i = 0; i < count; i++) {
+        argv[i + 1] = malloc(VALUE_SIZE);
+        if (!argv[i + 1]) {
+            fprintf(stderr, "Allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        if (emails)
+            snprintf(argv[i + 1], VALUE_SIZE, "user.%zu@host%zu.example.com", i, i % 97);
+        else
+            snprintf(argv[i + 1], VALUE_SIZE, "10.%zu.%zu.%zu", (i >> 16) & 0xff, (i >> 8) & 0xff,
+                     i & 0xff);
+    }
+    return argv;
+}
+
+static void free_argv(char **argv, size_t count)
+{
+    for (size_t i = 1; i <= count; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+static double measure(argus_option_t *options, char **argv, size_t count)
+{
+    argus_t argus = argus_init(options, "benchmark", "1.0.0");
+
+    clock_t start = clock();
+    if (argus_parse(&argus, (int)count + 1, argv) != ARGUS_SUCCESS) {
+        fprintf(stderr, "Parsing failed\n");
+        exit(EXIT_FAILURE);
+    }
+    clock_t end = clock();
+
+    argus_free(&argus);
+    return ((double)(end - start)) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    // Validators built from a regex are not constant initializers: the options live in main
+    ARGUS_OPTIONS(
+        ipv4_options,
+        POSITIONAL_MANY_STRING("values", HELP("Addresses"), VALIDATOR(V_REGEX(ARGUS_RE_IPV4))),
+    )
+    ARGUS_OPTIONS(
+        email_options,
+        POSITIONAL_MANY_STRING("values", HELP("Emails"), VALIDATOR(V_REGEX(ARGUS_RE_EMAIL))),
+    )
+
+    const size_t counts[] = {100, 10000, 100000};
+    struct
+    {
+        const char     *name;
+        argus_option_t *options;
+        bool            emails;
+    } cases[] = {
+        {"ipv4", ipv4_options, false},
+        {"email", email_options, true},
+    };
+
+    printf("=== ARGUS REGEX VALIDATOR BENCHMARK ===\n\n");
+    printf("%-10s | %-10s | %-12s | %-10s\n", "Pattern", "Values", "Parse (s)", "ns / value");
+    printf("--------------------------------------------------------\n");
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+            char **argv = generate_argv(counts[i], cases[c].emails);
+
+            double total = measure(cases[c].options, argv, counts[i]);
+            printf("%-10s | %-10zu | %-12.6f | %-10.1f\n", cases[c].name, counts[i], total,
+                   total * 1e9 / (double)counts[i]);
+
+            free_argv(argv, counts[i]);
+        }
+    }
+    printf("========================================================\n");
+    return 0;
+}
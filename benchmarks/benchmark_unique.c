@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "argus.h"
+
+// Measures FLAG_UNIQUE on large variadic positionals, with and without
+// FLAG_SORTED. Half of the values are repeated, in a scattered order.
+// Deduplication is hashed, or a single pass after sorting, so the time
+// per value should stay roughly flat from 10^3 to 10^6 values.
+
+#define VALUE_SIZE 24
+
+ARGUS_OPTIONS(
+    unique_int_options,
+    POSITIONAL_MANY_INT("values", HELP("Values"), FLAGS(FLAG_UNIQUE)),
+)
+
+ARGUS_OPTIONS(
+    sorted_int_options,
+    POSITIONAL_MANY_INT("values", HELP("Values"), FLAGS(FLAG_UNIQUE | FLAG_SORTED)),
+)
+
+ARGUS_OPTIONS(
+    unique_string_options,
+    POSITIONAL_MANY_STRING("values", HELP("Values"), FLAGS(FLAG_UNIQUE)),
+)
+
+ARGUS_OPTIONS(
+    sorted_string_options,
+    POSITIONAL_MANY_STRING("values", HELP("Values"), FLAGS(FLAG_UNIQUE | FLAG_SORTED)),
+)
+
+static char **generate_argv(size_t count, bool strings)
+{
+    char **argv = calloc(count + 2, sizeof(char *));
+    if (!argv) {
+        fprintf(stderr, "Allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    argv[0] = "benchmark";
+    for (size_t i = 0; i < count; i++) {
+        size_t value = (i * 2654435761u) % (count / 2 + 1);
+        argv[i + 1]  = malloc(VALUE_SIZE);
+        if (!argv[i + 1]) {
+            fprintf(stderr, "Allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        snprintf(argv[i + 1], VALUE_SIZE, strings ? "value-%zu" : "%zu", value);
+    }
+    return argv;
+}
+
+static void free_argv(char **argv, size_t count)
+{
+    for (size_t i = 1; i <= count; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+static double measure(argus_option_t *options, char **argv, size_t count, size_t *kept)
+{
+    argus_t argus = argus_init(options, "benchmark", "1.0.0");
+
+    clock_t start = clock();
+    if (argus_parse(&argus, (int)count + 1, argv) != ARGUS_SUCCESS) {
+        fprintf(stderr, "Parsing failed\n");
+        exit(EXIT_FAILURE);
+    }
+    clock_t end = clock();
+
+    *kept = argus_count(&argus, "values");
+    argus_free(&argus);
+    return ((double)(end - start)) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    const size_t counts[] = {1000, 100000, 1000000};
+    struct
+    {
+        const char     *name;
+        argus_option_t *options;
+        bool            strings;
+    } cases[] = {
+        {"int unique", unique_int_options, false},
+        {"int sorted+unique", sorted_int_options, false},
+        {"string unique", unique_string_options, true},
+        {"string sorted+unique", sorted_string_options, true},
+    };
+
+    printf("=== ARGUS UNIQUE VALUES BENCHMARK ===\n\n");
+    printf("%-22s | %-10s | %-10s | %-12s | %-10s\n", "Case", "Values", "Kept", "Parse (s)",
+           "ns / value");
+    printf("------------------------------------------------------------------------\n");
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+            char **argv = generate_argv(counts[i], cases[c].strings);
+            size_t kept;
+
+            double total = measure(cases[c].options, argv, counts[i], &kept);
+            printf("%-22s | %-10zu | %-10zu | %-12.6f | %-10.1f\n", cases[c].name, counts[i], kept,
+                   total, total * 1e9 / (double)counts[i]);
+
+            free_argv(argv, counts[i]);
+        }
+    }
+    printf("========================================================================\n");
+    return 0;
+}
@@ -37,6 +37,7 @@ const sidebars = {
       items: [
         'advanced/custom-handlers',
         'advanced/custom-validators',
+        'advanced/reusable-parsing',
       ],
     },
     {
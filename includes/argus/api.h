@@ -42,6 +42,57 @@ static inline argus_t argus_init(argus_option_t *options, const char *program_na
 #endif
 }
 
+ARGUS_API argus_schema_t *_argus_schema_compile(argus_option_t *options, const char *program_name,
+                                                const char *version, bool validate);
+
+/**
+ * argus_schema_compile - Compile options into a read-only schema
+ *
+ * The schema flattens every subcommand level and builds their lookup tables
+ * once. It is never written afterwards and can be shared between threads,
+ * each of them parsing into its own result.
+ *
+ * @param options      Array of command-line options
+ * @param program_name Name of the program
+ * @param version      Version string
+ *
+ * @return Compiled schema, or NULL on allocation failure
+ *
+ * @note
+ * Like argus_init, the options structure is validated when `ARGUS_DEBUG`
+ * is defined.
+ */
+static inline argus_schema_t *argus_schema_compile(argus_option_t *options,
+                                                   const char *program_name, const char *version)
+{
+#ifdef ARGUS_DEBUG
+    return _argus_schema_compile(options, program_name, version, true);
+#else
+    return _argus_schema_compile(options, program_name, version, false);
+#endif
+}
+
+/**
+ * argus_schema_free - Release a compiled schema
+ *
+ * Results created from the schema must be released first.
+ *
+ * @param schema  Schema to release (may be NULL)
+ */
+ARGUS_API void argus_schema_free(argus_schema_t *schema);
+
+/**
+ * argus_result_init - Create a parse result from a compiled schema
+ *
+ * The result is used like a context from argus_init: pass it to argus_parse,
+ * read it with the accessors and release it with argus_free.
+ *
+ * @param schema  Compiled schema
+ *
+ * @return New result, with error_code set to ARGUS_ERROR_MEMORY on allocation failure
+ */
+ARGUS_API argus_result_t argus_result_init(const argus_schema_t *schema);
+
 /**
  * argus_parse - Parse command-line arguments
  *
@@ -53,6 +104,69 @@ static inline argus_t argus_init(argus_option_t *options, const char *program_na
  */
 ARGUS_API int argus_parse(argus_t *argus, int argc, char **argv);
 
+/**
+ * argus_parse_line - Parse arguments given as a single command string
+ *
+ * The line is cut into arguments in place, like a shell would: words are
+ * separated by whitespace, single quotes keep their contents as is, double
+ * quotes and backslashes escape the next character. The line holds arguments
+ * only, without the program name, and must outlive the parsed values. The
+ * array of arguments is kept in the context, so parsing lines of similar
+ * length after argus_reset does not allocate it again.
+ *
+ * @param argus  Argus context
+ * @param line   Command string, modified in place
+ *
+ * @return Status code (0 for success, non-zero for error)
+ */
+ARGUS_API int argus_parse_line(argus_t *argus, char *line);
+
+/**
+ * argus_parse_packed - Parse arguments packed in a NUL-separated buffer
+ *
+ * The buffer holds the program name then each argument, every one of them
+ * followed by a NUL byte, like /proc/<pid>/cmdline. Arguments are indexed
+ * in place and never written to, so the buffer can be mapped read-only:
+ * parsed strings point into it, except the values a FLAG_BORROW option has
+ * to split, which are copied first. The buffer must outlive the parsed values.
+ *
+ * @param argus  Argus context
+ * @param buf    Packed arguments
+ * @param len    Size of the buffer, its last byte being a NUL
+ *
+ * @return Status code (0 for success, non-zero for error)
+ */
+ARGUS_API int argus_parse_packed(argus_t *argus, const char *buf, size_t len);
+
+/**
+ * argus_feed - Parse the next argument of a command line given one at a time
+ *
+ * For arguments read from a stream or a socket, without the program name.
+ * An option taking its value from the next argument waits for it. Arguments
+ * holding a value are copied, so the caller can reuse its buffer. Errors are
+ * reported as by argus_parse, and release the context the same way. Later
+ * calls to argus_feed and argus_finish then return the same error, without
+ * parsing anything, until argus_reset.
+ *
+ * @param argus  Argus context
+ * @param arg    Next argument
+ *
+ * @return Status code (0 for success, non-zero for error)
+ */
+ARGUS_API int argus_feed(argus_t *argus, const char *arg);
+
+/**
+ * argus_finish - Complete a command line given to argus_feed
+ *
+ * Fails if an option is still waiting for its value, then loads environment
+ * variables and validates the options like the end of argus_parse.
+ *
+ * @param argus  Argus context
+ *
+ * @return Status code (0 for success, non-zero for error)
+ */
+ARGUS_API int argus_finish(argus_t *argus);
+
 /**
  * argus_free - Clean up and free resources
  *
@@ -60,6 +174,60 @@ ARGUS_API int argus_parse(argus_t *argus, int argc, char **argv);
  */
 ARGUS_API void argus_free(argus_t *argus);
 
+/**
+ * argus_use_arena - Allocate the parsed values of a context from an arena
+ *
+ * Copies of strings, arrays and maps are then carved out of large blocks
+ * instead of being allocated one by one. They are released together by
+ * argus_free, and argus_reset makes the blocks available to the next parse.
+ * Call it before the first argus_parse. A failed parse keeps the arena, so it
+ * is still used once the context is reset.
+ *
+ * @param argus       Argus context
+ * @param block_size  Minimum size of each block (0 for the default)
+ *
+ * @return ARGUS_SUCCESS, or ARGUS_ERROR_MEMORY if the arena could not be created
+ */
+ARGUS_API int argus_use_arena(argus_t *argus, size_t block_size);
+
+/**
+ * argus_use_response_files - Expand @file arguments into the arguments of the file
+ *
+ * Each file holds arguments separated by whitespace, with shell-like single
+ * quotes, double quotes and backslash escapes. Files are memory-mapped and
+ * cut in place, so arguments and the values parsed from them point into the
+ * mapping until argus_reset or argus_free. Files can include other files up
+ * to MAX_RESPONSE_FILE_DEPTH levels. Arguments after "--" are not expanded.
+ *
+ * @param argus   Argus context
+ * @param enable  Whether @file arguments are expanded (disabled by default)
+ */
+ARGUS_API void argus_use_response_files(argus_t *argus, bool enable);
+
+/**
+ * argus_reset - Prepare a context for another call to argus_parse
+ *
+ * Options go back to their default values and are no longer set. Arrays and
+ * maps of the root options keep the buffers they already grew, so parsing
+ * similar command lines again does not reallocate them. Bound structs receive the defaults again,
+ * and the bound fields of options without a default are cleared.
+ *
+ * @param argus  Argus context
+ */
+ARGUS_API void argus_reset(argus_t *argus);
+
+/**
+ * argus_bind - Set the struct receiving the values of BIND options
+ *
+ * Bound fields receive the default values right away, then each value as it
+ * is parsed. Strings, arrays and maps are bound by pointer and stay owned by
+ * the context until argus_free.
+ *
+ * @param argus   Argus context
+ * @param target  Struct described by the BIND attributes (NULL to unbind)
+ */
+ARGUS_API void argus_bind(argus_t *argus, void *target);
+
 /**
  * Display functions
  */
@@ -97,6 +265,45 @@ ARGUS_API argus_value_t argus_get(argus_t *argus, const char *option_path);
  */
 ARGUS_API size_t argus_count(argus_t *argus, const char *option_path);
 
+/**
+ * argus_get_by_id - Get the value of a root option by its ID
+ *
+ * @param argus  Argus context
+ * @param id     Option ID generated by ARGUS_OPTIONS_IDS (OPT_<id>)
+ *
+ * @return Value of the option
+ */
+static inline argus_value_t argus_get_by_id(argus_t *argus, size_t id)
+{
+    return (argus->options[id].value);
+}
+
+/**
+ * argus_is_set_by_id - Check if a root option was set, by its ID
+ *
+ * @param argus  Argus context
+ * @param id     Option ID generated by ARGUS_OPTIONS_IDS (OPT_<id>)
+ *
+ * @return true if the option was set, false otherwise
+ */
+static inline bool argus_is_set_by_id(argus_t *argus, size_t id)
+{
+    return (argus->options[id].is_set);
+}
+
+/**
+ * argus_count_by_id - Get the number of values of a root option, by its ID
+ *
+ * @param argus  Argus context
+ * @param id     Option ID generated by ARGUS_OPTIONS_IDS (OPT_<id>)
+ *
+ * @return Number of values for the option
+ */
+static inline size_t argus_count_by_id(argus_t *argus, size_t id)
+{
+    return (argus->options[id].value_count);
+}
+
 /**
  * argus_has_command - Check if a subcommand was parsed
  *
@@ -190,4 +397,81 @@ ARGUS_API bool argus_map_next(argus_map_it_t *it);
  */
 ARGUS_API void argus_map_reset(argus_map_it_t *it);
 
+/**
+ * argus_resolve - Resolve an option path once for repeated value access
+ *
+ * The handle stays valid until argus_free. Paths relative to the active
+ * subcommand are resolved against the state after argus_parse.
+ *
+ * @param argus        Argus context
+ * @param option_path  Option path (name or subcommand.name format)
+ *
+ * @return Handle to the option, invalid if the path matched nothing
+ */
+ARGUS_API argus_handle_t argus_resolve(argus_t *argus, const char *option_path);
+
+/**
+ * argus_handle_valid - Check if a handle was resolved to an option
+ *
+ * @param handle  Option handle
+ *
+ * @return true if the handle refers to an option, false otherwise
+ */
+ARGUS_API bool argus_handle_valid(argus_handle_t handle);
+
+/**
+ * argus_handle_is_set - Check if the option of a handle was set
+ *
+ * @param handle  Option handle
+ *
+ * @return true if the option was set, false otherwise
+ */
+ARGUS_API bool argus_handle_is_set(argus_handle_t handle);
+
+/**
+ * argus_handle_count - Get the number of values of the option of a handle
+ *
+ * @param handle  Option handle
+ *
+ * @return Number of values for the option
+ */
+ARGUS_API size_t argus_handle_count(argus_handle_t handle);
+
+/**
+ * argus_handle_get - Get the value of the option of a handle
+ *
+ * @param handle  Option handle
+ *
+ * @return Value of the option, or {0} if the handle is invalid
+ */
+ARGUS_API argus_value_t argus_handle_get(argus_handle_t handle);
+
+/**
+ * Typed accessors, returning 0, false or NULL for an invalid handle
+ */
+ARGUS_API int64_t     argus_handle_int(argus_handle_t handle);
+ARGUS_API double      argus_handle_float(argus_handle_t handle);
+ARGUS_API bool        argus_handle_bool(argus_handle_t handle);
+ARGUS_API const char *argus_handle_string(argus_handle_t handle);
+
+/**
+ * argus_handle_array_get - Get an element from the array option of a handle
+ *
+ * @param handle  Option handle
+ * @param index   Index of the element to retrieve
+ *
+ * @return Value of the element, or {0} if not an array or index out of bounds
+ */
+ARGUS_API argus_value_t argus_handle_array_get(argus_handle_t handle, size_t index);
+
+/**
+ * argus_handle_map_get - Get a value from the map option of a handle
+ *
+ * @param handle  Option handle
+ * @param key     Key to look up in the map
+ *
+ * @return Value associated with the key, or {0} if not a map or key not found
+ */
+ARGUS_API argus_value_t argus_handle_map_get(argus_handle_t handle, const char *key);
+
 #endif /* ARGUS_API_H */
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_ARENA_H
+#define ARGUS_INTERNAL_ARENA_H
+
+#include <stddef.h>
+
+#include "argus/types.h"
+
+#define ARENA_DEFAULT_BLOCK_SIZE 4096
+
+/**
+ * arena_block_t - Chunk of memory served by an arena
+ */
+typedef struct arena_block_s
+{
+    struct arena_block_s *next; /* Next block, kept across resets */
+    size_t                size; /* Usable bytes in data */
+    size_t                used; /* Bytes already handed out */
+    max_align_t           data[];
+} arena_block_t;
+
+/**
+ * argus_arena_s - Bump allocator for the values of one context
+ *
+ * Allocations are never freed one by one: resetting the arena rewinds it to
+ * its first block in constant time and keeps every block for the next parse.
+ */
+struct argus_arena_s
+{
+    arena_block_t *first;      /* First block, NULL until the first allocation */
+    arena_block_t *current;    /* Block allocations are served from */
+    size_t         block_size; /* Minimum size of a new block */
+    void          *last;       /* Last allocation, may grow in place */
+};
+
+/**
+ * arena_create - Create an empty arena
+ *
+ * @param block_size  Minimum size of each block (0 for ARENA_DEFAULT_BLOCK_SIZE)
+ *
+ * @return New arena, or NULL on allocation failure
+ */
+argus_arena_t *arena_create(size_t block_size);
+
+/**
+ * arena_destroy - Release an arena and all of its blocks
+ *
+ * @param arena  Arena to release (may be NULL)
+ */
+void arena_destroy(argus_arena_t *arena);
+
+/**
+ * arena_reset - Make all the memory of an arena available again
+ *
+ * @param arena  Arena to rewind
+ */
+void arena_reset(argus_arena_t *arena);
+
+/**
+ * arena_alloc - Allocate memory from an arena
+ *
+ * @param arena  Arena to allocate from
+ * @param size   Number of bytes
+ *
+ * @return Memory aligned for any type, or NULL on allocation failure
+ */
+void *arena_alloc(argus_arena_t *arena, size_t size);
+
+/**
+ * arena_realloc - Grow an allocation of an arena
+ *
+ * The last allocation grows in place when its block has room left,
+ * otherwise the content is copied to a new allocation.
+ *
+ * @param arena     Arena the allocation comes from
+ * @param ptr       Allocation to grow (may be NULL)
+ * @param old_size  Current size of the allocation
+ * @param new_size  Requested size
+ *
+ * @return Grown allocation, or NULL on allocation failure
+ */
+void *arena_realloc(argus_arena_t *arena, void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * arena_strndup - Copy a string into an arena
+ *
+ * @param arena  Arena to allocate from
+ * @param str    String to copy
+ * @param len    Number of bytes to copy
+ *
+ * @return NUL-terminated copy, or NULL on allocation failure
+ */
+char *arena_strndup(argus_arena_t *arena, const char *str, size_t len);
+
+#endif /* ARGUS_INTERNAL_ARENA_H */
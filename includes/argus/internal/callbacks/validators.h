@@ -34,4 +34,11 @@ int range_validator(argus_t *argus, void *option_ptr, validator_data_t data);
  */
 int regex_validator(argus_t *argus, const char *value, validator_data_t data);
 
+/**
+ * regex_cache_free - Release the patterns compiled by regex_validator
+ *
+ * @param argus  Argus context
+ */
+void regex_cache_free(argus_t *argus);
+
 #endif /* ARGUS_INTERNAL_CALLBACKS_VALIDATORS_H */
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_CHOICE_TABLE_H
+#define ARGUS_INTERNAL_CHOICE_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argus/types.h"
+
+/**
+ * choice_table_s - Hash table of the choices of an enum option
+ *
+ * Open addressing with linear probing, slots hold the ordinal of a choice
+ * plus one (0 meaning empty). Built with the index of the level declaring
+ * the option, so contexts sharing a schema share its tables.
+ */
+typedef struct choice_table_s
+{
+    const choices_data_t *choices; /* Choices the table was built for */
+    uint32_t             *slots;
+    size_t                mask;
+} choice_table_t;
+
+/**
+ * choice_table_build - Build the hash table of a list of string choices
+ *
+ * @param choices  Choices of a V_CHOICE_ENUM validator
+ *
+ * @return New table, or NULL on allocation failure
+ */
+choice_table_t *choice_table_build(const choices_data_t *choices);
+
+/**
+ * choice_table_free - Release a table built by choice_table_build
+ *
+ * @param table  Table to release (may be NULL)
+ */
+void choice_table_free(choice_table_t *table);
+
+/**
+ * choice_table_find - Get the ordinal of a choice
+ *
+ * @param table  Choice table
+ * @param value  Value to look up
+ *
+ * @return Position of the first choice equal to value, or -1 if there is none
+ */
+int choice_table_find(const choice_table_t *table, const char *value);
+
+/**
+ * enum_choices - Get the choices declared by the V_CHOICE_ENUM validator of an option
+ *
+ * @param option  Option to inspect
+ *
+ * @return Choices, or NULL if the option has no V_CHOICE_ENUM validator
+ */
+const choices_data_t *enum_choices(const argus_option_t *option);
+
+#endif /* ARGUS_INTERNAL_CHOICE_TABLE_H */
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_ENV_TABLE_H
+#define ARGUS_INTERNAL_ENV_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argus/types.h"
+
+/**
+ * env_entry_s - Option reading an environment variable
+ */
+typedef struct env_entry_s
+{
+    argus_option_t *option;
+    uint32_t        name; /* Position of its variable in the names of the table */
+} env_entry_t;
+
+/**
+ * env_name_s - Environment variable read by one or more options
+ */
+typedef struct env_name_s
+{
+    const char *name;
+    size_t      len;
+    const char *value; /* Set by env_table_scan, NULL when the variable is not defined */
+} env_name_t;
+
+/**
+ * argus_env_table_s - Environment variables read by the active levels of a context
+ *
+ * Entries follow the options in declaration order, root level first. Variable
+ * names are hashed with open addressing and linear probing, slots hold the
+ * position of a name plus one (0 meaning empty). Built on the first parse and
+ * kept until the prefix or the active levels change.
+ */
+struct argus_env_table_s
+{
+    const char     *prefix; /* env_prefix the names were built with */
+    argus_option_t *levels[MAX_SUBCOMMAND_DEPTH + 1];
+    size_t          level_count;
+
+    env_entry_t *entries;
+    size_t       entry_count;
+    env_name_t  *names;
+    size_t       name_count;
+    uint32_t    *slots;
+    size_t       mask;
+    char        *buffer; /* Storage of every name */
+};
+
+/**
+ * env_name_format - Write the environment variable name of an option
+ *
+ * @param argus   Argus context
+ * @param option  Option to name
+ * @param dst     Destination, at least as large as the returned length plus one (may be NULL)
+ *
+ * @return Length of the name, 0 if the option reads no environment variable
+ */
+size_t env_name_format(const argus_t *argus, const argus_option_t *option, char *dst);
+
+/**
+ * env_table_get - Get the table of the active levels, building it if needed
+ *
+ * @param argus  Argus context
+ *
+ * @return Table owned by the context, or NULL on allocation failure
+ */
+argus_env_table_t *env_table_get(argus_t *argus);
+
+/**
+ * env_table_scan - Read the variables of the table in a single pass over the environment
+ *
+ * Like getenv, the first definition of a variable wins.
+ *
+ * @param table  Environment table
+ */
+void env_table_scan(argus_env_table_t *table);
+
+/**
+ * env_table_free - Release a table built by env_table_get
+ *
+ * @param table  Table to release (may be NULL)
+ */
+void env_table_free(argus_env_table_t *table);
+
+#endif /* ARGUS_INTERNAL_ENV_TABLE_H */
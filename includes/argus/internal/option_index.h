@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_OPTION_INDEX_H
+#define ARGUS_INTERNAL_OPTION_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argus/internal/choice_table.h"
+#include "argus/internal/subcommand_trie.h"
+#include "argus/types.h"
+
+/**
+ * argus_index_s - Lookup tables for one level of options
+ *
+ * Built once for the root options in argus_init and once for each subcommand level
+ * when it is entered. The subcommand trie is only built the first time a token
+ * has to be matched against the subcommands of the level. Tables hold option
+ * indices (position + 1, 0 meaning empty) rather than pointers, so an index only
+ * depends on the layout of the options array.
+ */
+struct argus_index_s
+{
+    argus_option_t *options; /* Options array this index was built for */
+    size_t          count;   /* Number of entries before OPTION_END */
+
+    /* Long names: open-addressing table with linear probing */
+    uint32_t *lname_slots;
+    size_t    lname_mask;
+
+    /* Short names: direct table indexed by (unsigned char)sname */
+    uint32_t sname_slots[256];
+
+    /* Positionals: fixed slots in declaration order, then the variadic sink */
+    uint32_t *positional_slots;
+    size_t    positional_count;
+    uint32_t  variadic_slot;
+
+    /* Subcommands: radix trie, built on first use */
+    subcommand_trie_t *subcommands;
+
+    /* Enum options: choice table by option position, NULL when the level has none */
+    choice_table_t **choice_tables;
+
+    /* Dependencies: bitsets of option positions, by option position. REQUIRE and CONFLICT
+     * lists are resolved for each option, members for each exclusive group header.
+     * NULL when the level has none */
+    size_t     dependency_words;
+    uint64_t **require_masks;
+    uint64_t **conflict_masks;
+    uint64_t **group_masks;
+
+    /* Validation: options checked even when the parse did not touch them (required
+     * positionals, options with a default), and the exclusive group header of each
+     * option (position + 1, 0 meaning none; NULL when the level has no such group) */
+    uint64_t *visit_mask;
+    uint32_t *group_slots;
+};
+
+/**
+ * index_build - Build the lookup index of an options level
+ *
+ * @param options  Options array (terminated by OPTION_END)
+ *
+ * @return New index, or NULL on allocation failure
+ */
+argus_index_t *index_build(argus_option_t *options);
+
+/**
+ * index_free - Release an index built by index_build
+ *
+ * @param index  Index to release (may be NULL)
+ */
+void index_free(argus_index_t *index);
+
+/**
+ * index_activate - Make sure the current level of the context has an index
+ *
+ * Reuses the index already stored at the current subcommand depth when it was
+ * built for the same options array, otherwise rebuilds it. Contexts created
+ * from a schema take the compiled index of the level instead.
+ *
+ * @param argus    Argus context
+ * @param options  Options array of the current level
+ *
+ * @return Index of the level, or NULL if it could not be built
+ */
+argus_index_t *index_activate(argus_t *argus, argus_option_t *options);
+
+/**
+ * index_get - Get the index of the current level if it matches an options array
+ *
+ * @param argus    Argus context
+ * @param options  Options array being searched
+ *
+ * @return Index, or NULL when none was built for this array
+ */
+argus_index_t *index_get(const argus_t *argus, const argus_option_t *options);
+
+/**
+ * index_release_all - Release every index owned by the context
+ *
+ * @param argus  Argus context
+ */
+void index_release_all(argus_t *argus);
+
+/**
+ * index_find_level - Find the index built for an options level of the context
+ *
+ * @param argus    Argus context
+ * @param options  Options array of the level
+ *
+ * @return Index, or NULL when no level of the context uses this array
+ */
+argus_index_t *index_find_level(const argus_t *argus, const argus_option_t *options);
+
+/**
+ * index_rebase - Translate an option found in an index to another copy of its level
+ *
+ * Indexes only depend on the layout of a level, so a schema index also serves
+ * the copies of that level owned by each result.
+ *
+ * @param index    Index the option was found in
+ * @param options  Options array laid out like the one of the index
+ * @param option   Option found in the index (may be NULL)
+ *
+ * @return Option at the same position in options, or NULL
+ */
+argus_option_t *index_rebase(const argus_index_t *index, argus_option_t *options,
+                             const argus_option_t *option);
+
+/**
+ * index_find_lname - Find an option by long name
+ *
+ * @param index  Level index
+ * @param lname  Long name (not necessarily NUL-terminated)
+ * @param len    Length of the long name
+ *
+ * @return Option, or NULL if not found
+ */
+argus_option_t *index_find_lname(const argus_index_t *index, const char *lname, size_t len);
+
+/**
+ * index_find_sname - Find an option by short name
+ *
+ * @param index  Level index
+ * @param sname  Short name
+ *
+ * @return Option, or NULL if not found
+ */
+argus_option_t *index_find_sname(const argus_index_t *index, char sname);
+
+/**
+ * index_find_positional - Find the positional receiving a given position
+ *
+ * @param index     Level index
+ * @param position  Zero-based position among positional arguments
+ *
+ * @return Fixed positional at that position, the variadic positional once
+ *         the fixed ones are exhausted, or NULL if there is none
+ */
+argus_option_t *index_find_positional(const argus_index_t *index, int position);
+
+/**
+ * index_find_choices - Find the choice table of an enum option
+ *
+ * Looks the option up in the level indexes of the context, so options of
+ * parent levels still resolve once a subcommand is entered.
+ *
+ * @param argus   Argus context
+ * @param option  Enum option
+ *
+ * @return Choice table, or NULL if no index of the context holds one for the option
+ */
+const choice_table_t *index_find_choices(const argus_t *argus, const argus_option_t *option);
+
+/**
+ * index_subcommands - Get the subcommand trie of a level, building it if needed
+ *
+ * @param index  Level index
+ *
+ * @return Subcommand trie, or NULL on allocation failure
+ */
+const subcommand_trie_t *index_subcommands(argus_index_t *index);
+
+#endif /* ARGUS_INTERNAL_OPTION_INDEX_H */
@@ -26,15 +26,65 @@ int parse_args(argus_t *argus, argus_option_t *options, int argc, char **argv);
 int find_subcommand(argus_t *argus, argus_option_t *options, const char *name,
                     argus_option_t **result);
 
+/**
+ * feed_arg - Parse one more argument of a command line given piece by piece
+ *
+ * Options taking their value from the next argument are kept pending until
+ * it is fed. Arguments whose text ends up in a value are copied first, so the
+ * caller can reuse its buffer.
+ *
+ * @param argus  Argus context
+ * @param arg    Argument
+ *
+ * @return Status code
+ */
+int feed_arg(argus_t *argus, const char *arg);
+
+/**
+ * feed_end - Complete a command line given to feed_arg
+ *
+ * Reports an option still waiting for its value, and clears the feed state.
+ *
+ * @param argus  Argus context
+ *
+ * @return Status code
+ */
+int feed_end(argus_t *argus);
+
+/**
+ * feed_clear - Clear the feed state without releasing its buffers
+ *
+ * @param argus  Argus context
+ */
+void feed_clear(argus_t *argus);
+
+/**
+ * release_parse_state - Release everything argus_free does but the arenas
+ *
+ * A failed parse releases its context this way, so the arenas set up by
+ * argus_use_arena are still there once it is reset.
+ *
+ * @param argus  Argus context
+ */
+void release_parse_state(argus_t *argus);
+
+/**
+ * feed_release - Release the buffers of the feed state
+ *
+ * @param argus  Argus context
+ */
+void feed_release(argus_t *argus);
+
 /**
  * Handle different types of arguments
  */
-int handle_subcommand(argus_t *argus, argus_option_t *option, int argc, char **argv);
-int handle_positional(argus_t *argus, argus_option_t *options, char *value, int position);
-int handle_long_option(argus_t *argus, argus_option_t *options, char *arg, char **argv, int argc,
-                       int *current_index);
-int handle_short_option(argus_t *argus, argus_option_t *options, char *arg, char **argv, int argc,
+void enter_subcommand(argus_t *argus, argus_option_t *option);
+int  handle_subcommand(argus_t *argus, argus_option_t *option, int argc, char **argv);
+int  handle_positional(argus_t *argus, argus_option_t *options, char *value, int position);
+int  handle_long_option(argus_t *argus, argus_option_t *options, char *arg, char **argv, int argc,
                         int *current_index);
+int  handle_short_option(argus_t *argus, argus_option_t *options, char *arg, char **argv,
+                         int argc, int *current_index);
 
 /**
  * Validation and callback execution
@@ -42,9 +92,51 @@ int handle_short_option(argus_t *argus, argus_option_t *options, char *arg, char
 int post_parse_validation(argus_t *argus);
 int execute_callbacks(argus_t *argus, argus_option_t *option, char *value);
 
+/**
+ * touch_option - Record that an option was set, for post_parse_validation
+ *
+ * Repeated occurrences of the option in a row are recorded once.
+ *
+ * @param argus   Argus context
+ * @param option  Option that was set
+ */
+void touch_option(argus_t *argus, argus_option_t *option);
+
+/**
+ * borrow_copy - Copy a read-only value that a FLAG_BORROW option will cut
+ *
+ * Borrowing options split their value in place, which must not happen to the
+ * environment or to a read-only argument buffer. The copy lives in the context
+ * until it is freed or reset.
+ *
+ * @param argus  Argus context
+ * @param value  Read-only value
+ *
+ * @return Writable copy, or NULL on allocation failure
+ */
+char *borrow_copy(argus_t *argus, const char *value);
+
+/**
+ * touched_release - Release the list of options set by the last parse
+ *
+ * @param argus  Argus context
+ */
+void touched_release(argus_t *argus);
+
 /**
  * Load option values from environment variables
  */
 int load_env_vars(argus_t *argus);
 
+/**
+ * finalize_collections - Apply sorting and uniqueness flags once parsing is done
+ *
+ * Arrays, variadics and maps collect every occurrence first, then FLAG_SORTED,
+ * FLAG_UNIQUE, FLAG_SORTED_KEY, FLAG_SORTED_VALUE and FLAG_UNIQUE_VALUE are
+ * applied once to each collection of the active levels.
+ *
+ * @param argus  Argus context
+ */
+void finalize_collections(argus_t *argus);
+
 #endif /* ARGUS_INTERNAL_PARSING_H */
@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_RESPONSE_FILES_H
+#define ARGUS_INTERNAL_RESPONSE_FILES_H
+
+#include <stddef.h>
+
+#include "argus/types.h"
+
+/**
+ * response_file_s - Contents of a response file, tokenized in place
+ *
+ * Memory-mapped copy-on-write, or read into a heap buffer where mmap is missing.
+ */
+typedef struct response_file_s
+{
+    char  *data;
+    size_t size; /* Bytes reserved for data, one more than the file */
+} response_file_t;
+
+/**
+ * argus_responses_s - Command line with its response files expanded
+ *
+ * Arguments point into argv or into the files, which stay mapped until the
+ * context is reset or freed since parsed values may point into them too.
+ */
+struct argus_responses_s
+{
+    char **argv;
+    size_t argc;
+    size_t capacity;
+
+    response_file_t *files;
+    size_t           file_count;
+    size_t           file_capacity;
+};
+
+/**
+ * response_files_expand - Replace the @file arguments of a command line by their contents
+ *
+ * Each file holds arguments separated by whitespace. Single quotes keep their
+ * contents as is, double quotes and backslashes escape the next character.
+ * Arguments read from a file can name other response files, up to
+ * MAX_RESPONSE_FILE_DEPTH levels. Arguments after "--" and quoted ones are
+ * never expanded.
+ *
+ * @param argus  Argus context
+ * @param argc   Argument count, updated when arguments were expanded
+ * @param argv   Argument values, updated when arguments were expanded
+ *
+ * @return Status code
+ */
+int response_files_expand(argus_t *argus, int *argc, char ***argv);
+
+/**
+ * response_files_release - Unmap the response files of the last parse
+ *
+ * @param argus  Argus context
+ */
+void response_files_release(argus_t *argus);
+
+#endif /* ARGUS_INTERNAL_RESPONSE_FILES_H */
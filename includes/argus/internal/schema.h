@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_SCHEMA_H
+#define ARGUS_INTERNAL_SCHEMA_H
+
+#include <stddef.h>
+
+#include "argus/types.h"
+
+/**
+ * schema_level_t - One options array (root or subcommand) of a schema
+ */
+typedef struct schema_level_s
+{
+    argus_option_t *declared; /* Options array as declared by the application */
+    size_t          offset;   /* Position of the level in the records */
+    size_t          length;   /* Number of records, OPTION_END included */
+    argus_index_t  *index;    /* Lookup index, with its subcommand trie */
+} schema_level_t;
+
+/**
+ * schema_link_t - Subcommand record and the level of its sub_options
+ */
+typedef struct schema_link_s
+{
+    size_t position;
+    size_t level;
+} schema_link_t;
+
+/**
+ * argus_schema_s - Compiled, read-only description of a command line
+ *
+ * Every level reachable from the root options is flattened into a single
+ * records array, level after level, with sub_options pointing inside it.
+ * Results copy the records and relink them, so the positions used by the
+ * shared indexes are valid in every copy.
+ */
+struct argus_schema_s
+{
+    const char *program_name;
+    const char *version;
+
+    argus_option_t *records;
+    size_t          record_count;
+
+    schema_level_t *levels; /* Sorted by offset, root first */
+    size_t          level_count;
+
+    schema_link_t *links;
+    size_t         link_count;
+};
+
+/**
+ * schema_compile - Compile options into a schema
+ *
+ * @param options       Root options array
+ * @param program_name  Name of the program
+ * @param version       Version string
+ *
+ * @return New schema, or NULL on allocation failure
+ */
+argus_schema_t *schema_compile(argus_option_t *options, const char *program_name,
+                               const char *version);
+
+/**
+ * schema_release - Release a schema built by schema_compile
+ *
+ * @param schema  Schema to release (may be NULL)
+ */
+void schema_release(argus_schema_t *schema);
+
+/**
+ * schema_instantiate - Copy the records of a schema for a new result
+ *
+ * @param schema  Compiled schema
+ *
+ * @return Relinked copy of the records, or NULL on allocation failure
+ */
+argus_option_t *schema_instantiate(const argus_schema_t *schema);
+
+/**
+ * schema_find_level - Find the level of an options array of a result
+ *
+ * @param schema   Compiled schema
+ * @param storage  Records of the result
+ * @param options  Options array inside storage
+ *
+ * @return Level, or NULL if options does not start a level
+ */
+const schema_level_t *schema_find_level(const argus_schema_t *schema,
+                                        const argus_option_t *storage,
+                                        const argus_option_t *options);
+
+#endif /* ARGUS_INTERNAL_SCHEMA_H */
@@ -0,0 +1,49 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_SORT_H
+#define ARGUS_INTERNAL_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Collections smaller than this are left to qsort */
+#define SORT_KERNEL_THRESHOLD 64
+
+/**
+ * sort_key_t - How the sorted value of an element is read and ordered
+ */
+typedef enum sort_key_e
+{
+    SORT_KEY_INT,    /* as_int, signed order */
+    SORT_KEY_FLOAT,  /* as_float, numeric order */
+    SORT_KEY_BOOL,   /* as_bool, false first */
+    SORT_KEY_STRING, /* as_string, strcmp order with NULL first */
+} sort_key_t;
+
+/**
+ * sort_values - Sort a collection with a kernel specialized for its key
+ *
+ * Numbers and booleans go through an LSD radix sort on their bit patterns
+ * (sign-flipped for integers, IEEE-754 order for doubles), strings through a
+ * multikey quicksort. Elements are sorted as records of their key and position,
+ * then moved once into place.
+ *
+ * @param base    First element
+ * @param count   Number of elements
+ * @param stride  Size of an element
+ * @param offset  Offset of the argus_value_t holding the key in an element
+ * @param key     Kind of key
+ *
+ * @return true if the collection was sorted, false if it is below
+ *         SORT_KERNEL_THRESHOLD or scratch memory could not be allocated
+ */
+bool sort_values(void *base, size_t count, size_t stride, size_t offset, sort_key_t key);
+
+#endif /* ARGUS_INTERNAL_SORT_H */
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#ifndef ARGUS_INTERNAL_SUBCOMMAND_TRIE_H
+#define ARGUS_INTERNAL_SUBCOMMAND_TRIE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argus/types.h"
+
+/**
+ * subcommand_node_t - Node of a subcommand radix trie
+ *
+ * Edge labels point into the subcommand names, and every node keeps the number
+ * of subcommands below it, so a prefix is known to be unique or ambiguous as
+ * soon as the token is consumed.
+ */
+typedef struct subcommand_node_s
+{
+    const char *label;     /* Edge label, points into a subcommand name */
+    size_t      label_len; /* Length of the edge label */
+    uint32_t    child;     /* First child node (0 = none) */
+    uint32_t    sibling;   /* Next sibling node (0 = none) */
+    uint32_t    terminal;  /* Subcommand ending here (position + 1, 0 = none) */
+    uint32_t    first;     /* First declared subcommand below (position + 1) */
+    uint32_t    count;     /* Number of subcommands below, this node included */
+} subcommand_node_t;
+
+/**
+ * subcommand_trie_t - Radix trie over the subcommands of one level
+ */
+typedef struct subcommand_trie_s
+{
+    argus_option_t    *options; /* Options array the trie was built for */
+    subcommand_node_t *nodes;   /* Node 0 is the root */
+    uint32_t           node_count;
+} subcommand_trie_t;
+
+/**
+ * subcommand_match_t - Result of matching a token against a trie
+ */
+typedef struct subcommand_match_s
+{
+    argus_option_t *option; /* Exact or unique prefix match, NULL otherwise */
+    size_t          count;  /* Number of subcommands the token could designate */
+    uint32_t        node;   /* Node holding every candidate */
+} subcommand_match_t;
+
+/**
+ * subcommand_trie_build - Build the subcommand trie of an options level
+ *
+ * @param options  Options array (terminated by OPTION_END)
+ *
+ * @return New trie, or NULL on allocation failure
+ */
+subcommand_trie_t *subcommand_trie_build(argus_option_t *options);
+
+/**
+ * subcommand_trie_free - Release a trie built by subcommand_trie_build
+ *
+ * @param trie  Trie to release (may be NULL)
+ */
+void subcommand_trie_free(subcommand_trie_t *trie);
+
+/**
+ * subcommand_trie_match - Match a token against the subcommands
+ *
+ * An exact name always wins. Otherwise the token is treated as an abbreviation:
+ * match->count tells whether it designates no subcommand, exactly one (stored
+ * in match->option), or several.
+ *
+ * @param trie   Subcommand trie
+ * @param name   Token to match
+ * @param match  Receives the result
+ */
+void subcommand_trie_match(const subcommand_trie_t *trie, const char *name,
+                           subcommand_match_t *match);
+
+/**
+ * subcommand_trie_candidates - List the subcommands designated by a match
+ *
+ * @param trie        Subcommand trie
+ * @param match       Result of subcommand_trie_match
+ * @param candidates  Receives the candidates, in declaration order
+ * @param max         Capacity of candidates
+ *
+ * @return Number of candidates stored
+ */
+size_t subcommand_trie_candidates(const subcommand_trie_t *trie, const subcommand_match_t *match,
+                                  argus_option_t **candidates, size_t max);
+
+#endif /* ARGUS_INTERNAL_SUBCOMMAND_TRIE_H */
@@ -12,6 +12,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -53,18 +54,38 @@
 /**
  * String utility functions
  */
-char  *starts_with(const char *prefix, const char *str);
-char **split(const char *str, const char *charset);
-void   free_split(char **split);
-int    putnchar(char c, size_t n);
+char    *starts_with(const char *prefix, const char *str);
+char   **split(const char *str, const char *charset);
+void     free_split(char **split);
+char   **parse_split(argus_t *argus, const char *str, const char *charset);
+void     parse_free_split(argus_t *argus, char **split);
+char    *split_next(char **cursor, const char *charset);
+int      shell_word_next(char **cursor, char *end, char **word, bool *quoted);
+int      putnchar(char c, size_t n);
+uint32_t hash_string(const char *str, size_t len);
+size_t   hash_table_size(size_t count);
+
+/**
+ * Parse-time allocation, served by the context arena when it has one
+ */
+void *parse_alloc(argus_t *argus, size_t size);
+void *parse_realloc(argus_t *argus, void *ptr, size_t old_size, size_t new_size);
+char *parse_strndup(argus_t *argus, const char *str, size_t len);
+char *parse_strdup(argus_t *argus, const char *str);
+void  parse_release(argus_t *argus, void *ptr);
 
 /**
  * Multi_value utility functions
  */
 #define MULTI_VALUE_INITIAL_CAPACITY 8
-void adjust_array_size(argus_option_t *option);
-void adjust_map_size(argus_option_t *option);
+typedef int (*value_setter_t)(argus_t *argus, argus_option_t *option, char *value);
+int  split_values(argus_t *argus, argus_option_t *option, char *value, value_setter_t setter);
+void adjust_array_size(argus_t *argus, argus_option_t *option);
+int  sink_value(argus_t *argus, argus_option_t *option, argus_value_t value);
+void adjust_map_size(argus_t *argus, argus_option_t *option);
+void clear_multi_values(argus_option_t *option);
 int  map_find_key(argus_option_t *option, const char *key);
+void map_index_add(argus_option_t *option, size_t position);
 void apply_array_flags(argus_option_t *option);
 void apply_map_flags(argus_option_t *option);
 
@@ -75,6 +96,10 @@ int           cmp_value(argus_valtype_t type, argus_value_t a, argus_value_t b);
 argus_value_t choices_to_value(argus_valtype_t type, argus_value_t choices, size_t choices_count,
                                size_t index);
 void          free_option_value(argus_option_t *option);
+void          reset_option_value(argus_option_t *option);
+void          release_option_string(argus_t *argus, argus_option_t *option, void *str);
+void          bind_option_value(argus_t *argus, argus_option_t *option);
+void          unbind_option_value(argus_t *argus, argus_option_t *option);
 void          print_value(FILE *stream, argus_valtype_t type, argus_value_t value);
 void print_value_array(FILE *stream, argus_valtype_t type, argus_value_t *values, size_t count);
 
@@ -82,10 +107,14 @@ void print_value_array(FILE *stream, argus_valtype_t type, argus_value_t *values
  * Option lookup functions
  */
 argus_option_t       *find_option_by_lname(argus_option_t *options, const char *lname);
+argus_option_t       *find_long_option(argus_t *argus, argus_option_t *options, const char *lname,
+                                       size_t len);
 argus_option_t       *find_option_by_name(argus_option_t *options, const char *name);
 argus_option_t       *find_option_by_sname(argus_option_t *options, char sname);
+argus_option_t       *find_short_option(argus_t *argus, argus_option_t *options, char sname);
 argus_option_t       *find_positional(argus_option_t *options, int position);
-argus_option_t       *find_option_by_active_path(argus_t argus, const char *option_path);
+argus_option_t       *find_positional_option(argus_t *argus, argus_option_t *options, int position);
+argus_option_t       *find_option_by_active_path(const argus_t *argus, const char *option_path);
 const argus_option_t *get_active_options(argus_t *argus);
 
 #endif /* ARGUS_INTERNAL_UTILS_H */
@@ -10,6 +10,8 @@
 #ifndef ARGUS_OPTIONS_H
 #define ARGUS_OPTIONS_H
 
+#include <stddef.h>
+
 #include "argus/internal/compiler.h"
 #include "argus/types.h"
 
@@ -42,6 +44,8 @@ ARGUS_API int variadic_int_handler(argus_t *argus, argus_option_t *option, char
 ARGUS_API int variadic_float_handler(argus_t *argus, argus_option_t *option, char *value);
 ARGUS_API int free_variadic_string_handler(argus_option_t *option);
 
+ARGUS_API int enum_handler(argus_t *argus, argus_option_t *option, char *value);
+
 ARGUS_API int range_validator(argus_t *argus, void *option_ptr, validator_data_t data);
 ARGUS_API int length_validator(argus_t *argus, void *option_ptr, validator_data_t data);
 ARGUS_API int count_validator(argus_t *argus, void *option_ptr, validator_data_t data);
@@ -49,6 +53,7 @@ ARGUS_API int regex_validator(argus_t *argus, void *value_ptr, validator_data_t
 ARGUS_API int choices_string_validator(argus_t *argus, void *option_ptr, validator_data_t data);
 ARGUS_API int choices_int_validator(argus_t *argus, void *option_ptr, validator_data_t data);
 ARGUS_API int choices_float_validator(argus_t *argus, void *option_ptr, validator_data_t data);
+ARGUS_API int choices_enum_validator(argus_t *argus, void *option_ptr, validator_data_t data);
 
 ARGUS_API char *format_range_validator(validator_data_t data);
 ARGUS_API char *format_length_validator(validator_data_t data);
@@ -78,6 +83,7 @@ ARGUS_API char *format_choices_validator(validator_data_t data);
                                 .have_default = true
 #define HANDLER(fn)             .handler = (argus_handler_t)(fn)
 #define ACTION(fn)              .action = (argus_action_t)(fn)
+#define SINK(fn, data)          .sink = (argus_sink_t)(fn), .sink_data = (void *)(data)
 #define FREE_HANDLER(fn)        .free_handler = (argus_free_handler_t)(fn)
 #define HINT(_hint)             .hint = _hint
 #define REQUIRE(...)            .require = (const char*[]){__VA_ARGS__, NULL}
@@ -86,6 +92,16 @@ ARGUS_API char *format_choices_validator(validator_data_t data);
 #define FLAGS(_flags)           .flags = _flags
 #define ENV_VAR(name)           .env_name = name
 #define VALIDATOR(...)          .validators = (validator_entry_t*[]){__VA_ARGS__, NULL}
+#define BIND(...)               _BIND_SELECT(__VA_ARGS__, _BIND_COUNT, _BIND_FIELD, )(__VA_ARGS__)
+
+#define _BIND_SELECT(_1, _2, _3, name, ...) name
+#define _BIND_FIELD(type, field) \
+    .bind_offset = offsetof(type, field), \
+    .bind_size = sizeof(((type *)0)->field)
+#define _BIND_COUNT(type, field, count_field) \
+    _BIND_FIELD(type, field), \
+    .bind_count_offset = offsetof(type, count_field), \
+    .bind_count_size = sizeof(((type *)0)->count_field)
 
 /*
  * Validator macros
@@ -135,6 +151,15 @@ ARGUS_API char *format_choices_validator(validator_data_t data);
             .type = VALUE_TYPE_FLOAT \
         }}), ORDER_POST)
 
+// Choices of an OPTION_ENUM, the option value is the position of the matched choice
+#define V_CHOICE_ENUM(...) \
+    MAKE_VALIDATOR(choices_enum_validator, format_choices_validator, \
+        ((validator_data_t){ .choices = { \
+            .as_strings = (char*[]){ __VA_ARGS__ }, \
+            .count = sizeof((char*[]){ __VA_ARGS__ }) / sizeof(char*), \
+            .type = VALUE_TYPE_STRING \
+        }}), ORDER_POST)
+
 /*
  * Base option definition macros
  */
@@ -182,6 +207,8 @@ ARGUS_API char *format_choices_validator(validator_data_t data);
     OPTION_BASE(short_name, long_name, VALUE_TYPE_INT, HANDLER(int_handler), __VA_ARGS__)
 #define OPTION_FLOAT(short_name, long_name, ...)                                                   \
     OPTION_BASE(short_name, long_name, VALUE_TYPE_FLOAT, HANDLER(float_handler), __VA_ARGS__)
+#define OPTION_ENUM(short_name, long_name, ...)                                                    \
+    OPTION_BASE(short_name, long_name, VALUE_TYPE_INT, HANDLER(enum_handler), __VA_ARGS__)
 
 #define OPTION_ARRAY_STRING(short_name, long_name, ...)                                            \
     OPTION_BASE(short_name, long_name, VALUE_TYPE_ARRAY_STRING, HANDLER(array_string_handler),     \
@@ -259,4 +286,27 @@ ARGUS_API char *format_choices_validator(validator_data_t data);
     argus_option_t name[] = {__VA_ARGS__ OPTION_END()};                                            \
     ARGUS_COMPILER_RULE_POP()
 
+#define _ARGUS_OPTION_ID(id, option)    OPT_##id,
+#define _ARGUS_OPTION_ENTRY(id, option) option,
+
+/*
+ * Options array definition macro with compile-time option IDs
+ * @param name: Name of the options array
+ * @param list: X-macro list of the options, calling X(id, option) for each one
+ *
+ * Also defines an enum where OPT_<id> is the index of the option in the array,
+ * for use with argus_get_by_id(). IDs share the enum namespace of the
+ * translation unit, so they must be unique across every array defined in it.
+ *
+ * Example:
+ *   #define MY_OPTIONS(X)                                        \
+ *       X(help, HELP_OPTION())                                   \
+ *       X(verbose, OPTION_FLAG('v', "verbose", HELP("Verbose")))
+ *
+ *   ARGUS_OPTIONS_IDS(options, MY_OPTIONS)
+ */
+#define ARGUS_OPTIONS_IDS(name, list)                                                              \
+    enum { list(_ARGUS_OPTION_ID) };                                                               \
+    ARGUS_OPTIONS(name, list(_ARGUS_OPTION_ENTRY))
+
 #endif /* ARGUS_OPTIONS_H */
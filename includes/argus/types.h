@@ -17,11 +17,17 @@
 #include <stdint.h>
 
 /* Forward declarations */
-typedef struct argus_s         argus_t;
-typedef struct argus_option_s  argus_option_t;
-typedef union argus_value_u    argus_value_t;
-typedef struct argus_pair_s    argus_pair_t;
-typedef union validator_data_u validator_data_t;
+typedef struct argus_s             argus_t;
+typedef struct argus_option_s      argus_option_t;
+typedef union argus_value_u        argus_value_t;
+typedef struct argus_pair_s        argus_pair_t;
+typedef union validator_data_u     validator_data_t;
+typedef struct argus_index_s       argus_index_t;
+typedef struct argus_schema_s      argus_schema_t;
+typedef struct argus_arena_s       argus_arena_t;
+typedef struct argus_regex_cache_s argus_regex_cache_t;
+typedef struct argus_env_table_s   argus_env_table_t;
+typedef struct argus_responses_s   argus_responses_t;
 
 /**
  * argus_valtype_t - Types of values an option can hold
@@ -97,6 +103,7 @@ typedef enum argus_optflags_e
     FLAG_SORTED_VALUE = 1 << 11, /* Map values are sorted */
     FLAG_SORTED_KEY   = 1 << 12, /* Map keys are sorted */
     FLAG_UNIQUE_VALUE = 1 << 13, /* Map values are unique */
+    FLAG_BORROW       = 1 << 15, /* String values point into argv instead of being copied */
 
     /* Group flags */
     FLAG_EXCLUSIVE = 1 << 14, /* Only one option in group can be set */
@@ -108,9 +115,9 @@ typedef enum argus_optflags_e
 #define VERSIONING_FLAG_MASK (FLAG_DEPRECATED | FLAG_EXPERIMENTAL)
 #define OPTION_FLAG_MASK                                                                           \
     (FLAG_REQUIRED | FLAG_HIDDEN | FLAG_ADVANCED | FLAG_EXIT | VERSIONING_FLAG_MASK)
-#define OPTION_ARRAY_FLAG_MASK (FLAG_SORTED | FLAG_UNIQUE | VERSIONING_FLAG_MASK)
+#define OPTION_ARRAY_FLAG_MASK (FLAG_SORTED | FLAG_UNIQUE | FLAG_BORROW | VERSIONING_FLAG_MASK)
 #define OPTION_MAP_FLAG_MASK                                                                       \
-    (FLAG_SORTED_VALUE | FLAG_SORTED_KEY | FLAG_UNIQUE_VALUE | VERSIONING_FLAG_MASK)
+    (FLAG_SORTED_VALUE | FLAG_SORTED_KEY | FLAG_UNIQUE_VALUE | FLAG_BORROW | VERSIONING_FLAG_MASK)
 #define GROUP_FLAG_MASK           (FLAG_EXCLUSIVE)
 #define POSITIONAL_FLAG_MASK      (FLAG_REQUIRED)
 #define POSITIONAL_MANY_FLAG_MASK (OPTION_ARRAY_FLAG_MASK | FLAG_REQUIRED | FLAG_OPTIONAL)
@@ -171,6 +178,14 @@ typedef struct argus_map_iterator_s
     argus_value_t value;     /* Current value */
 } argus_map_it_t;
 
+/**
+ * Option handle, resolved once by argus_resolve for repeated value access
+ */
+typedef struct argus_handle_s
+{
+    argus_option_t *_option; /* Resolved option, NULL if the path matched nothing */
+} argus_handle_t;
+
 /**
  * argus_range_t - Min/max range for numeric validation
  */
@@ -222,6 +237,7 @@ typedef int (*argus_free_handler_t)(argus_option_t *);
 typedef int (*argus_validator_t)(argus_t *, void *, validator_data_t);
 typedef char *(*argus_validator_formatter_t)(validator_data_t);
 typedef int (*argus_action_t)(argus_t *, void *);
+typedef int (*argus_sink_t)(argus_t *, argus_value_t, void *);
 
 typedef enum validation_order_e
 {
@@ -263,12 +279,20 @@ struct argus_option_s
     bool            have_default;
     size_t          value_count;
     size_t          value_capacity;
+    uint32_t       *map_slots; /* Hash index of the map keys (position + 1, 0 = empty) */
     char           *env_name;
+    size_t          bind_offset;       /* Offset of the bound field in the bind target */
+    size_t          bind_size;         /* Size of the bound field (0 = not bound) */
+    size_t          bind_count_offset; /* Offset of the bound element count */
+    size_t          bind_count_size;   /* Size of the bound element count (0 = not bound) */
 
     /* Callbacks metadata */
     argus_handler_t      handler;
     argus_free_handler_t free_handler;
     validator_entry_t  **validators;
+    argus_sink_t         sink;       /* Receives each array value instead of storing it */
+    void                *sink_data;  /* Passed to the sink along with each value */
+    size_t               sink_count; /* Values given to the sink, for V_COUNT */
 
     /* Dependencies metadata */
     const char **conflict;
@@ -294,6 +318,11 @@ struct argus_option_s
     #define MAX_SUBCOMMAND_DEPTH 8
 #endif
 
+/* Maximum depth of response files including other response files */
+#ifndef MAX_RESPONSE_FILE_DEPTH
+    #define MAX_RESPONSE_FILE_DEPTH 8
+#endif
+
 /**
  * argus_helper_config_t - Helper configuration and theme settings
  */
@@ -317,6 +346,40 @@ typedef struct argus_helper_s
     argus_helper_config_t config;
 } argus_helper_t;
 
+/**
+ * argus_touched_s - Options set by the current parse, so validation skips the others
+ */
+typedef struct argus_touched_s
+{
+    argus_option_t **options;
+    size_t           count;
+    size_t           capacity;
+    bool             overflow; /* An append failed, validation visits every option */
+} argus_touched_t;
+
+/**
+ * argus_tokens_s - Arguments cut out of a command string, kept for the next one
+ */
+typedef struct argus_tokens_s
+{
+    char **argv;
+    size_t capacity;
+} argus_tokens_t;
+
+/**
+ * argus_feed_s - State kept by argus_feed between two arguments
+ */
+typedef struct argus_feed_s
+{
+    argus_option_t *options;          /* Options of the current level, NULL before the first one */
+    int             positional_index; /* Position of the next positional argument */
+    bool            only_positional;  /* "--" was fed */
+    char           *pending;          /* Option waiting for its value in the next argument */
+    size_t          pending_size;
+    argus_option_t *pending_option;   /* Option the pending argument resolved to */
+    int             status;           /* Error of a failed feed, returned until argus_reset */
+} argus_feed_t;
+
 /**
  * argus_s - Main library context
  */
@@ -334,6 +397,29 @@ struct argus_s
     argus_option_t       *options;
     const argus_option_t *subcommand_stack[MAX_SUBCOMMAND_DEPTH];
     size_t                subcommand_depth;
+    argus_index_t        *indexes[MAX_SUBCOMMAND_DEPTH + 1]; /* Lookup index per level */
+    argus_option_t       *level_options[MAX_SUBCOMMAND_DEPTH + 1]; /* Options of each index */
+    void                 *bind_target; /* Struct receiving the BIND fields */
+    const argus_schema_t *schema;      /* Compiled schema, NULL if built by argus_init */
+    argus_option_t       *storage;     /* Per-result copy of the schema options */
+    argus_arena_t        *arena;       /* Allocator for parsed values, NULL for the heap */
+    argus_arena_t        *env_arena;   /* Read-only values cut by FLAG_BORROW options */
+    argus_regex_cache_t  *regex_cache; /* Patterns compiled by V_REGEX validators */
+    argus_touched_t       touched;     /* Options set since init or the last reset */
+    argus_env_table_t    *env_table;   /* Environment variables read by the active levels */
+    bool                  at_files;    /* Expand @file arguments into their contents */
+    argus_responses_t    *responses;   /* Response files read by the last parse */
+    argus_tokens_t        tokens;      /* Arguments of the last argus_parse_line or _packed */
+    bool                  const_args;  /* Arguments are read-only, see argus_parse_packed */
+    argus_feed_t          feed;        /* State of a parse fed by argus_feed */
 };
 
+/**
+ * argus_result_t - Parse state created from a compiled schema
+ *
+ * Results own a private copy of the option records, so several results of the
+ * same schema can be parsed concurrently. Every argus_t accessor applies.
+ */
+typedef struct argus_s argus_result_t;
+
 #endif /* ARGUS_TYPES_H */
@@ -0,0 +1,25 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stddef.h>
+
+#include "argus/errors.h"
+#include "argus/internal/arena.h"
+#include "argus/types.h"
+
+int argus_use_arena(argus_t *argus, size_t block_size)
+{
+    if (argus->arena != NULL)
+        return (ARGUS_SUCCESS);
+
+    argus->arena = arena_create(block_size);
+    if (argus->arena == NULL)
+        return (ARGUS_ERROR_MEMORY);
+    return (ARGUS_SUCCESS);
+}
@@ -0,0 +1,32 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stddef.h>
+
+#include "argus/internal/utils.h"
+#include "argus/types.h"
+
+static void bind_current_values(argus_t *argus, argus_option_t *options)
+{
+    for (size_t i = 0; options[i].type != TYPE_NONE; ++i) {
+        argus_option_t *option = &options[i];
+
+        if (option->type == TYPE_SUBCOMMAND && option->sub_options != NULL)
+            bind_current_values(argus, option->sub_options);
+        else if (option->is_set || option->have_default)
+            bind_option_value(argus, option);
+    }
+}
+
+void argus_bind(argus_t *argus, void *target)
+{
+    argus->bind_target = target;
+    if (target != NULL)
+        bind_current_values(argus, argus->options);
+}
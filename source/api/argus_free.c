@@ -9,6 +9,12 @@
 
 #include <stdlib.h>
 
+#include "argus/internal/arena.h"
+#include "argus/internal/callbacks/validators.h"
+#include "argus/internal/env_table.h"
+#include "argus/internal/option_index.h"
+#include "argus/internal/parsing.h"
+#include "argus/internal/response_files.h"
 #include "argus/internal/utils.h"
 #include "argus/types.h"
 
@@ -18,12 +24,41 @@ static void free_options(argus_option_t *options)
         free_option_value(option);
 }
 
-void argus_free(argus_t *argus)
+void release_parse_state(argus_t *argus)
 {
+    if (argus->options == NULL)
+        return;
     free_options(argus->options);
     for (size_t i = 0; i < argus->subcommand_depth; ++i) {
         const argus_option_t *subcommand = argus->subcommand_stack[i];
         argus_option_t       *options    = subcommand->sub_options;
         free_options(options);
     }
+    index_release_all(argus);
+    regex_cache_free(argus);
+    touched_release(argus);
+    env_table_free(argus->env_table);
+    argus->env_table = NULL;
+    response_files_release(argus);
+    free(argus->tokens.argv);
+    argus->tokens = (argus_tokens_t){0};
+    feed_release(argus);
+
+    // Results of a schema own their records
+    if (argus->storage != NULL) {
+        free(argus->storage);
+        argus->storage = NULL;
+        argus->options = NULL;
+    }
+}
+
+void argus_free(argus_t *argus)
+{
+    release_parse_state(argus);
+
+    // Values parsed into the arena are released all at once
+    arena_destroy(argus->arena);
+    arena_destroy(argus->env_arena);
+    argus->arena     = NULL;
+    argus->env_arena = NULL;
 }
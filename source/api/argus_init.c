@@ -13,6 +13,7 @@
 
 #include "argus/errors.h"
 #include "argus/internal/display.h"
+#include "argus/internal/option_index.h"
 #include "argus/types.h"
 
 int validate_structure(argus_t *argus, argus_option_t *options);
@@ -34,5 +35,8 @@ argus_t _argus_init_validate(argus_option_t *options, const char *program_name,
             exit(EXIT_FAILURE);
     }
 
+    // A missing index is not fatal: lookups fall back to scanning the options
+    argus.indexes[0]       = index_build(options);
+    argus.level_options[0] = options;
     return (argus);
 }
@@ -7,20 +7,37 @@
  * See LICENSE file in the project root for full license information.
  */
 
+#include <limits.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "argus/errors.h"
+#include "argus/internal/arena.h"
 #include "argus/internal/display.h"
 #include "argus/internal/parsing.h"
+#include "argus/internal/response_files.h"
+#include "argus/internal/utils.h"
 #include "argus/types.h"
 
 void argus_free(argus_t *argus);
 
-int argus_parse(argus_t *argus, int argc, char **argv)
+#define LINE_TOKENS_INITIAL_CAPACITY 16
+
+// Release a failed parse, its arenas are only rewound for the next one
+static void release_failed_parse(argus_t *argus)
+{
+    release_parse_state(argus);
+    if (argus->arena != NULL)
+        arena_reset(argus->arena);
+    if (argus->env_arena != NULL)
+        arena_reset(argus->env_arena);
+}
+
+// Exits once help or version was shown, reports errors and releases the context
+static int check_parse_status(argus_t *argus, int status)
 {
-    int status        = parse_args(argus, argus->options, argc - 1, &argv[1]);
     argus->error_code = status;
     if (status == ARGUS_SHOULD_EXIT) {
         argus_free(argus);
@@ -33,18 +50,181 @@ int argus_parse(argus_t *argus, int argc, char **argv)
         for (size_t i = 0; i < argus->subcommand_depth; ++i)
             fprintf(stderr, " %s", argus->subcommand_stack[i]->name);
         fprintf(stderr, " --help' for more information.\n");
-        argus_free(argus);
-        return (status);
+        release_failed_parse(argus);
     }
+    return (status);
+}
 
-    status = load_env_vars(argus);
+// Environment, collections and validation, once every argument is parsed
+static int complete_parse(argus_t *argus)
+{
+    int status = load_env_vars(argus);
     if (status != ARGUS_SUCCESS) {
-        argus_free(argus);
+        release_failed_parse(argus);
         return (status);
     }
 
+    finalize_collections(argus);
     status = post_parse_validation(argus);
     if (status != ARGUS_SUCCESS)
-        argus_free(argus);
+        release_failed_parse(argus);
+    return (status);
+}
+
+static int parse_arguments(argus_t *argus, int count, char **args)
+{
+    int status = ARGUS_SUCCESS;
+
+    if (argus->at_files)
+        status = response_files_expand(argus, &count, &args);
+    if (status == ARGUS_SUCCESS)
+        status = parse_args(argus, argus->options, count, args);
+    status = check_parse_status(argus, status);
+    if (status != ARGUS_SUCCESS)
+        return (status);
+    return (complete_parse(argus));
+}
+
+int argus_parse(argus_t *argus, int argc, char **argv)
+{
+    if (argus->options == NULL)
+        return (ARGUS_ERROR_MEMORY);
+    return (parse_arguments(argus, argc - 1, &argv[1]));
+}
+
+static int push_token(argus_t *argus, size_t count, char *token)
+{
+    argus_tokens_t *tokens = &argus->tokens;
+
+    // Keep a slot for the NULL terminator
+    if (count + 1 >= tokens->capacity) {
+        size_t capacity = tokens->capacity ? tokens->capacity * 2 : LINE_TOKENS_INITIAL_CAPACITY;
+        char **argv     = realloc(tokens->argv, capacity * sizeof(char *));
+        if (argv == NULL) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+            return (ARGUS_ERROR_MEMORY);
+        }
+        tokens->argv     = argv;
+        tokens->capacity = capacity;
+    }
+    tokens->argv[count] = token;
+    return (ARGUS_SUCCESS);
+}
+
+static int tokenize_line(argus_t *argus, char *line, int *count)
+{
+    char  *cursor = line;
+    char  *end    = line + strlen(line);
+    size_t tokens = 0;
+    char  *token;
+    bool   quoted;
+    int    found;
+
+    while ((found = shell_word_next(&cursor, end, &token, &quoted)) > 0) {
+        if (tokens == (size_t)INT_MAX) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_ARGUMENT, "Too many arguments");
+            return (ARGUS_ERROR_INVALID_ARGUMENT);
+        }
+        int status = push_token(argus, tokens++, token);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+    }
+    if (found < 0) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_FORMAT,
+                            "Unterminated quote in command line");
+        return (ARGUS_ERROR_INVALID_FORMAT);
+    }
+
+    int status = push_token(argus, tokens, NULL);
+    *count     = (int)tokens;
+    return (status);
+}
+
+int argus_parse_line(argus_t *argus, char *line)
+{
+    if (argus->options == NULL)
+        return (ARGUS_ERROR_MEMORY);
+
+    int count  = 0;
+    int status = tokenize_line(argus, line, &count);
+    if (status != ARGUS_SUCCESS) {
+        release_failed_parse(argus);
+        return (status);
+    }
+    return (parse_arguments(argus, count, argus->tokens.argv));
+}
+
+int argus_parse_packed(argus_t *argus, const char *buf, size_t len)
+{
+    if (argus->options == NULL)
+        return (ARGUS_ERROR_MEMORY);
+    if (len == 0 || buf[len - 1] != '\0') {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_FORMAT,
+                            "Packed arguments must end with a NUL byte");
+        release_failed_parse(argus);
+        return (ARGUS_ERROR_INVALID_FORMAT);
+    }
+
+    // Index every argument but the program name, without touching the buffer
+    const char *end    = buf + len;
+    const char *token  = (const char *)memchr(buf, '\0', len) + 1;
+    size_t      tokens = 0;
+    int         status = ARGUS_SUCCESS;
+
+    for (; token < end && status == ARGUS_SUCCESS; token += strlen(token) + 1) {
+        if (tokens == (size_t)INT_MAX) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_ARGUMENT, "Too many arguments");
+            status = ARGUS_ERROR_INVALID_ARGUMENT;
+            break;
+        }
+        status = push_token(argus, tokens++, (char *)token);
+    }
+    if (status == ARGUS_SUCCESS)
+        status = push_token(argus, tokens, NULL);
+    if (status != ARGUS_SUCCESS) {
+        release_failed_parse(argus);
+        return (status);
+    }
+
+    // Built-in handlers never write through the pointers once const_args is set
+    argus->const_args = true;
+    status            = parse_arguments(argus, (int)tokens, argus->tokens.argv);
+    argus->const_args = false;
     return (status);
 }
+
+// The context is released by then, so the error is kept after the release
+static int fail_feed(argus_t *argus, int status)
+{
+    argus->feed.status = status;
+    return (status);
+}
+
+int argus_feed(argus_t *argus, const char *arg)
+{
+    // Once an argument failed, the rest of the command line is not parsed
+    if (argus->feed.status != ARGUS_SUCCESS)
+        return (argus->feed.status);
+    if (argus->options == NULL)
+        return (ARGUS_ERROR_MEMORY);
+
+    int status = feed_arg(argus, arg);
+    if (status != ARGUS_SUCCESS)
+        return (fail_feed(argus, check_parse_status(argus, status)));
+    return (ARGUS_SUCCESS);
+}
+
+int argus_finish(argus_t *argus)
+{
+    if (argus->feed.status != ARGUS_SUCCESS)
+        return (argus->feed.status);
+    if (argus->options == NULL)
+        return (ARGUS_ERROR_MEMORY);
+
+    int status = check_parse_status(argus, feed_end(argus));
+    if (status == ARGUS_SUCCESS)
+        status = complete_parse(argus);
+    if (status != ARGUS_SUCCESS)
+        return (fail_feed(argus, status));
+    return (ARGUS_SUCCESS);
+}
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdlib.h>
+
+#include "argus/errors.h"
+#include "argus/internal/arena.h"
+#include "argus/internal/option_index.h"
+#include "argus/internal/parsing.h"
+#include "argus/internal/response_files.h"
+#include "argus/internal/schema.h"
+#include "argus/internal/utils.h"
+#include "argus/types.h"
+
+void argus_bind(argus_t *argus, void *target);
+
+static void reset_options(argus_t *argus, argus_option_t *options, bool keep_buffers)
+{
+    for (argus_option_t *option = options; option->type != TYPE_NONE; ++option) {
+        if (!keep_buffers)
+            free_option_value(option);
+        reset_option_value(option);
+        // argus_bind only rewrites defaults, other fields would point into released buffers
+        if (!option->have_default)
+            unbind_option_value(argus, option);
+    }
+}
+
+void argus_reset(argus_t *argus)
+{
+    // A failed parse released the records of a result, take a fresh copy
+    if (argus->options == NULL && argus->schema != NULL) {
+        argus->storage = schema_instantiate(argus->schema);
+        argus->options = argus->storage;
+        if (argus->options == NULL) {
+            argus->error_code = ARGUS_ERROR_MEMORY;
+            return;
+        }
+    }
+    if (argus->options == NULL)
+        return;
+
+    // Only the levels entered by the last parse can hold values. argus_free only walks the
+    // levels on the stack, so the ones left here give their buffers back now
+    reset_options(argus, argus->options, true);
+    for (size_t i = 0; i < argus->subcommand_depth; ++i) {
+        reset_options(argus, argus->subcommand_stack[i]->sub_options, false);
+        argus->subcommand_stack[i] = NULL;
+    }
+    argus->subcommand_depth = 0;
+    argus->touched.count    = 0;
+    argus->touched.overflow = false;
+    if (argus->arena != NULL)
+        arena_reset(argus->arena);
+    if (argus->env_arena != NULL)
+        arena_reset(argus->env_arena);
+    response_files_release(argus);
+    feed_clear(argus);
+    argus->error_code = ARGUS_SUCCESS;
+
+    // Subcommand indexes stay cached, the root one is rebuilt if a failed parse released it
+    index_activate(argus, argus->options);
+    if (argus->bind_target != NULL)
+        argus_bind(argus, argus->bind_target);
+}
@@ -0,0 +1,17 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdbool.h>
+
+#include "argus/types.h"
+
+void argus_use_response_files(argus_t *argus, bool enable)
+{
+    argus->at_files = enable;
+}
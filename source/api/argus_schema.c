@@ -0,0 +1,54 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "argus/errors.h"
+#include "argus/internal/display.h"
+#include "argus/internal/schema.h"
+#include "argus/types.h"
+
+int validate_structure(argus_t *argus, argus_option_t *options);
+
+argus_schema_t *_argus_schema_compile(argus_option_t *options, const char *program_name,
+                                      const char *version, bool validate)
+{
+    if (validate) {
+        argus_t argus = {.program_name = program_name, .version = version, .options = options};
+        if (validate_structure(&argus, options) != ARGUS_SUCCESS)
+            exit(EXIT_FAILURE);
+    }
+    return (schema_compile(options, program_name, version));
+}
+
+void argus_schema_free(argus_schema_t *schema)
+{
+    schema_release(schema);
+}
+
+argus_result_t argus_result_init(const argus_schema_t *schema)
+{
+    argus_result_t result = {
+        .program_name = schema->program_name,
+        .version      = schema->version,
+        .helper       = {.config = get_default_helper_config()},
+        .schema       = schema,
+    };
+
+    result.storage = schema_instantiate(schema);
+    if (result.storage == NULL) {
+        result.error_code = ARGUS_ERROR_MEMORY;
+        return (result);
+    }
+    result.options          = result.storage;
+    result.indexes[0]       = schema->levels[0].index;
+    result.level_options[0] = result.storage;
+    return (result);
+}
@@ -11,12 +11,13 @@
 #include "argus/internal/utils.h"
 #include "argus/types.h"
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 argus_value_t argus_get(argus_t *argus, const char *option_path)
 {
     argus->error_code      = 0;
-    argus_option_t *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t *option = find_option_by_active_path(argus, option_path);
     if (option == NULL) {
         argus->error_code = ARGUS_ERROR_NO_VALUE;
         return ((argus_value_t){.raw = 0});
@@ -26,7 +27,7 @@ argus_value_t argus_get(argus_t *argus, const char *option_path)
 
 bool argus_is_set(argus_t *argus, const char *option_path)
 {
-    argus_option_t *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t *option = find_option_by_active_path(argus, option_path);
     if (option == NULL)
         return (false);
     return (option->is_set);
@@ -34,7 +35,7 @@ bool argus_is_set(argus_t *argus, const char *option_path)
 
 size_t argus_count(argus_t *argus, const char *option_path)
 {
-    argus_option_t *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t *option = find_option_by_active_path(argus, option_path);
     if (option == NULL)
         return (0);
     return (option->value_count);
@@ -43,7 +44,7 @@ size_t argus_count(argus_t *argus, const char *option_path)
 argus_value_t argus_array_get(argus_t *argus, const char *option_path, size_t index)
 {
     argus->error_code      = 0;
-    argus_option_t *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t *option = find_option_by_active_path(argus, option_path);
 
     if (option == NULL) {
         argus->error_code = ARGUS_ERROR_NO_VALUE;
@@ -69,7 +70,7 @@ argus_value_t argus_array_get(argus_t *argus, const char *option_path, size_t in
 argus_value_t argus_map_get(argus_t *argus, const char *option_path, const char *key)
 {
     argus->error_code      = 0;
-    argus_option_t *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t *option = find_option_by_active_path(argus, option_path);
 
     if (option == NULL) {
         argus->error_code = ARGUS_ERROR_NO_VALUE;
@@ -83,21 +84,96 @@ argus_value_t argus_map_get(argus_t *argus, const char *option_path, const char
     }
 
     // Look for the key in the map
-    for (size_t i = 0; i < option->value_count; ++i) {
-        if (option->value.as_map[i].key && strcmp(option->value.as_map[i].key, key) == 0) {
-            return option->value.as_map[i].value;
-        }
-    }
+    int key_index = map_find_key(option, key);
+    if (key_index >= 0)
+        return option->value.as_map[key_index].value;
 
     // Key not found
     argus->error_code = ARGUS_ERROR_INVALID_KEY;
     return ((argus_value_t){.raw = 0});
 }
 
+argus_handle_t argus_resolve(argus_t *argus, const char *option_path)
+{
+    argus_handle_t handle = {._option = find_option_by_active_path(argus, option_path)};
+
+    argus->error_code = handle._option == NULL ? ARGUS_ERROR_NO_VALUE : 0;
+    return (handle);
+}
+
+bool argus_handle_valid(argus_handle_t handle)
+{
+    return (handle._option != NULL);
+}
+
+bool argus_handle_is_set(argus_handle_t handle)
+{
+    if (handle._option == NULL)
+        return (false);
+    return (handle._option->is_set);
+}
+
+size_t argus_handle_count(argus_handle_t handle)
+{
+    if (handle._option == NULL)
+        return (0);
+    return (handle._option->value_count);
+}
+
+argus_value_t argus_handle_get(argus_handle_t handle)
+{
+    if (handle._option == NULL)
+        return ((argus_value_t){.raw = 0});
+    return (handle._option->value);
+}
+
+int64_t argus_handle_int(argus_handle_t handle)
+{
+    return (argus_handle_get(handle).as_int64);
+}
+
+double argus_handle_float(argus_handle_t handle)
+{
+    return (argus_handle_get(handle).as_float);
+}
+
+bool argus_handle_bool(argus_handle_t handle)
+{
+    return (argus_handle_get(handle).as_bool);
+}
+
+const char *argus_handle_string(argus_handle_t handle)
+{
+    return (argus_handle_get(handle).as_string);
+}
+
+argus_value_t argus_handle_array_get(argus_handle_t handle, size_t index)
+{
+    argus_option_t *option = handle._option;
+
+    if (option == NULL || !(option->value_type & (VALUE_TYPE_ARRAY | VALUE_TYPE_VARIADIC)))
+        return ((argus_value_t){.raw = 0});
+    if (index >= option->value_count)
+        return ((argus_value_t){.raw = 0});
+    return (option->value.as_array[index]);
+}
+
+argus_value_t argus_handle_map_get(argus_handle_t handle, const char *key)
+{
+    argus_option_t *option = handle._option;
+
+    if (option == NULL || !(option->value_type & VALUE_TYPE_MAP))
+        return ((argus_value_t){.raw = 0});
+    int key_index = map_find_key(option, key);
+    if (key_index < 0)
+        return ((argus_value_t){.raw = 0});
+    return (option->value.as_map[key_index].value);
+}
+
 argus_array_it_t argus_array_it(argus_t *argus, const char *option_path)
 {
     argus_array_it_t it     = {0};
-    argus_option_t  *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t  *option = find_option_by_active_path(argus, option_path);
 
     if (option == NULL || !(option->value_type & (VALUE_TYPE_ARRAY | VALUE_TYPE_VARIADIC)))
         return it;  // Return empty iterator
@@ -126,7 +202,7 @@ void argus_array_reset(argus_array_it_t *it)
 argus_map_it_t argus_map_it(argus_t *argus, const char *option_path)
 {
     argus_map_it_t  it     = {0};
-    argus_option_t *option = find_option_by_active_path(*argus, option_path);
+    argus_option_t *option = find_option_by_active_path(argus, option_path);
 
     if (option == NULL || !(option->value_type & VALUE_TYPE_MAP))
         return it;  // Return empty iterator
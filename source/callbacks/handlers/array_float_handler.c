@@ -15,31 +15,36 @@
 #include "argus/options.h"
 #include "argus/types.h"
 
-static void set_value(argus_option_t *option, char *value)
+static int set_value(argus_t *argus, argus_option_t *option, char *value)
 {
-    adjust_array_size(option);
+    if (option->sink != NULL)
+        return (sink_value(argus, option, (argus_value_t){.as_float = strtof(value, NULL)}));
+
+    adjust_array_size(argus, option);
     option->value.as_array[option->value_count].as_float = strtof(value, NULL);
     option->value_count++;
+    return (ARGUS_SUCCESS);
 }
 
 int array_float_handler(argus_t *argus, argus_option_t *option, char *value)
 {
-    UNUSED(argus);
-
     if (strchr(value, ',') != NULL) {
-        char **splited_values = split(value, ",");
+        char **splited_values = parse_split(argus, value, ",");
         if (splited_values == NULL) {
             ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to split string '%s'", value);
             return ARGUS_ERROR_MEMORY;
         }
-        for (size_t i = 0; splited_values[i] != NULL; ++i)
-            set_value(option, splited_values[i]);
-        free_split(splited_values);
+        for (size_t i = 0; splited_values[i] != NULL; ++i) {
+            int status = set_value(argus, option, splited_values[i]);
+            if (status != ARGUS_SUCCESS) {
+                parse_free_split(argus, splited_values);
+                return status;
+            }
+        }
+        parse_free_split(argus, splited_values);
     } else
-        set_value(option, value);
+        return (set_value(argus, option, value));
 
-    apply_array_flags(option);
-    option->is_allocated = true;
     return (ARGUS_SUCCESS);
 }
 
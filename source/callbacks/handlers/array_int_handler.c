@@ -85,13 +85,20 @@ static int parse_int_range(int_argus_range_t *range, const char *value)
 /**
  * Add a range of integers to the option's value array
  */
-static void add_range_values(argus_option_t *option, const int_argus_range_t *range)
+static int add_range_values(argus_t *argus, argus_option_t *option, const int_argus_range_t *range)
 {
     for (int i = range->start; i <= range->end; i++) {
-        adjust_array_size(option);
-        option->value.as_array[option->value_count].as_int = i;
+        if (option->sink != NULL) {
+            int status = sink_value(argus, option, (argus_value_t){.as_int64 = i});
+            if (status != ARGUS_SUCCESS)
+                return (status);
+            continue;
+        }
+        adjust_array_size(argus, option);
+        option->value.as_array[option->value_count].as_int64 = i;
         option->value_count++;
     }
+    return (ARGUS_SUCCESS);
 }
 
 /**
@@ -106,8 +113,7 @@ static int set_value(argus_t *argus, argus_option_t *option, char *value)
                             "Invalid integer or range format: '%s'", value);
         return ARGUS_ERROR_INVALID_FORMAT;
     }
-    add_range_values(option, &range);
-    return (ARGUS_SUCCESS);
+    return (add_range_values(argus, option, &range));
 }
 
 /**
@@ -120,7 +126,7 @@ static int set_value(argus_t *argus, argus_option_t *option, char *value)
 int array_int_handler(argus_t *argus, argus_option_t *option, char *value)
 {
     if (strchr(value, ',') != NULL) {
-        char **splited_values = split(value, ",");
+        char **splited_values = parse_split(argus, value, ",");
         if (splited_values == NULL) {
             ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to split string '%s'", value);
             return ARGUS_ERROR_MEMORY;
@@ -129,20 +135,18 @@ int array_int_handler(argus_t *argus, argus_option_t *option, char *value)
         for (size_t i = 0; splited_values[i] != NULL; ++i) {
             int status = set_value(argus, option, splited_values[i]);
             if (status != ARGUS_SUCCESS) {
-                free_split(splited_values);
+                parse_free_split(argus, splited_values);
                 return status;
             }
         }
 
-        free_split(splited_values);
+        parse_free_split(argus, splited_values);
     } else {
         int status = set_value(argus, option, value);
         if (status != ARGUS_SUCCESS)
             return status;
     }
 
-    apply_array_flags(option);
-    option->is_allocated = true;
     return (ARGUS_SUCCESS);
 }
 
@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/errors.h"
+#include "argus/internal/choice_table.h"
+#include "argus/internal/option_index.h"
+#include "argus/options.h"
+#include "argus/types.h"
+
+static int find_ordinal(argus_t *argus, argus_option_t *option, const choices_data_t *choices,
+                        const char *value)
+{
+    const choice_table_t *table = index_find_choices(argus, option);
+
+    if (table != NULL && table->choices == choices)
+        return (choice_table_find(table, value));
+
+    // Options outside of any index, like the ones checked at init
+    for (size_t i = 0; i < choices->count; ++i) {
+        if (strcmp(choices->as_strings[i], value) == 0)
+            return ((int)i);
+    }
+    return (-1);
+}
+
+int enum_handler(argus_t *argus, argus_option_t *option, char *value)
+{
+    const choices_data_t *choices = enum_choices(option);
+    if (choices == NULL) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_HANDLER,
+                            "Option '%s' has no V_CHOICE_ENUM validator", option->name);
+        return (ARGUS_ERROR_INVALID_HANDLER);
+    }
+
+    int ordinal = find_ordinal(argus, option, choices, value);
+    if (ordinal < 0) {
+        char *choices_formatted = format_choices_validator((validator_data_t){.choices = *choices});
+        if (choices_formatted) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_CHOICE, "Value '%s' is not one of [%s]",
+                                value, choices_formatted);
+            free(choices_formatted);
+        } else {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_CHOICE,
+                                "Value '%s' is not one of the choices", value);
+        }
+        return (ARGUS_ERROR_INVALID_CHOICE);
+    }
+
+    option->value = (argus_value_t){.as_int64 = ordinal};
+    return (ARGUS_SUCCESS);
+}
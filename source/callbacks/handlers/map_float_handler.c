@@ -32,7 +32,11 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
     }
 
     // Split the string at the separator
-    char *key = safe_strndup(pair, separator - pair);
+    char *key = pair;
+    if (option->flags & FLAG_BORROW)
+        *separator = '\0';
+    else
+        key = parse_strndup(argus, pair, separator - pair);
     if (key == NULL) {
         ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory for key '%s'",
                             key);
@@ -48,6 +52,7 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
     if (*value == '\0' || *endptr != '\0') {
         ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_VALUE,
                             "Invalid float value for key '%s': '%s'", key, value);
+        release_option_string(argus, option, key);
         return ARGUS_ERROR_INVALID_VALUE;
     }
 
@@ -56,14 +61,16 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
 
     // Key exists, update value
     if (key_index >= 0) {
+        release_option_string(argus, option, key);
         option->value.as_map[key_index].value.as_float = float_value;
     } else {
         // Key doesn't exist, add new entry
-        adjust_map_size(option);
+        adjust_map_size(argus, option);
 
         option->value.as_map[option->value_count].key            = key;
         option->value.as_map[option->value_count].value.as_float = float_value;
         option->value_count++;
+        map_index_add(option, option->value_count - 1);
     }
 
     return ARGUS_SUCCESS;
@@ -76,33 +83,7 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
  */
 int map_float_handler(argus_t *argus, argus_option_t *option, char *value)
 {
-    // Process comma-separated pairs
-    if (strchr(value, ',') != NULL) {
-        char **pairs = split(value, ",");
-        if (pairs == NULL) {
-            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to split string '%s'", value);
-            return ARGUS_ERROR_MEMORY;
-        }
-
-        for (size_t i = 0; pairs[i] != NULL; ++i) {
-            int status = set_kv_pair(argus, option, pairs[i]);
-            if (status != ARGUS_SUCCESS) {
-                free_split(pairs);
-                return status;
-            }
-        }
-
-        free_split(pairs);
-    } else {
-        // Single key-value pair
-        int status = set_kv_pair(argus, option, value);
-        if (status != ARGUS_SUCCESS)
-            return status;
-    }
-
-    apply_map_flags(option);
-    option->is_allocated = true;
-    return ARGUS_SUCCESS;
+    return (split_values(argus, option, value, set_kv_pair));
 }
 
 /**
@@ -112,8 +93,10 @@ int free_map_float_handler(argus_option_t *option)
 {
     if (option->value.as_map != NULL) {
         // No need to free float values
-        for (size_t i = 0; i < option->value_count; ++i)
-            free((void *)option->value.as_map[i].key);
+        if (!(option->flags & FLAG_BORROW)) {
+            for (size_t i = 0; i < option->value_count; ++i)
+                free((void *)option->value.as_map[i].key);
+        }
         free(option->value.as_map);
     }
     return ARGUS_SUCCESS;
@@ -32,15 +32,21 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
     }
 
     // Split the string at the separator
-    char *key = safe_strndup(pair, separator - pair);
+    char *key = pair;
+    if (option->flags & FLAG_BORROW)
+        *separator = '\0';
+    else
+        key = parse_strndup(argus, pair, separator - pair);
     if (key == NULL) {
         ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory for key '%s'",
                             key);
         return ARGUS_ERROR_MEMORY;
     }
-    char *value = safe_strdup(separator + 1);
+    char *value = separator + 1;
+    if (!(option->flags & FLAG_BORROW))
+        value = parse_strdup(argus, value);
     if (value == NULL) {
-        free(key);
+        release_option_string(argus, option, key);
         ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory for value '%s'",
                             value);
         return ARGUS_ERROR_MEMORY;
@@ -51,16 +57,18 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
 
     if (key_index >= 0) {
         // Key exists, update value
-        free(option->value.as_map[key_index].value.as_string);
+        release_option_string(argus, option, key);
+        release_option_string(argus, option, option->value.as_map[key_index].value.as_string);
         option->value.as_map[key_index].value.as_string = value;
     } else {
         // Key doesn't exist, add new entry
 
-        adjust_map_size(option);
+        adjust_map_size(argus, option);
 
         option->value.as_map[option->value_count].key             = key;
         option->value.as_map[option->value_count].value.as_string = value;
         option->value_count++;
+        map_index_add(option, option->value_count - 1);
     }
 
     return ARGUS_SUCCESS;
@@ -74,33 +82,7 @@ static int set_kv_pair(argus_t *argus, argus_option_t *option, char *pair)
  */
 int map_string_handler(argus_t *argus, argus_option_t *option, char *value)
 {
-    // Process comma-separated pairs
-    if (strchr(value, ',') != NULL) {
-        char **pairs = split(value, ",");
-        if (pairs == NULL) {
-            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to split string '%s'", value);
-            return ARGUS_ERROR_MEMORY;
-        }
-
-        for (size_t i = 0; pairs[i] != NULL; ++i) {
-            int status = set_kv_pair(argus, option, pairs[i]);
-            if (status != ARGUS_SUCCESS) {
-                free_split(pairs);
-                return status;
-            }
-        }
-
-        free_split(pairs);
-    } else {
-        // Single key-value pair
-        int status = set_kv_pair(argus, option, value);
-        if (status != ARGUS_SUCCESS)
-            return status;
-    }
-
-    apply_map_flags(option);
-    option->is_allocated = true;
-    return ARGUS_SUCCESS;
+    return (split_values(argus, option, value, set_kv_pair));
 }
 
 /**
@@ -109,9 +91,12 @@ int map_string_handler(argus_t *argus, argus_option_t *option, char *value)
 int free_map_string_handler(argus_option_t *option)
 {
     if (option->value.as_map != NULL) {
-        for (size_t i = 0; i < option->value_count; ++i) {
-            free((void *)option->value.as_map[i].key);
-            free((void *)option->value.as_map[i].value.as_string);
+        // Borrowed keys and values belong to argv
+        if (!(option->flags & FLAG_BORROW)) {
+            for (size_t i = 0; i < option->value_count; ++i) {
+                free((void *)option->value.as_map[i].key);
+                free((void *)option->value.as_map[i].value.as_string);
+            }
         }
         free(option->value.as_map);
     }
@@ -16,17 +16,23 @@
 #include "argus/options.h"
 #include "argus/types.h"
 
-static int set_float_value(argus_option_t *option, char *value)
+static int set_float_value(argus_t *argus, argus_option_t *option, char *value)
 {
-    adjust_array_size(option);
-    if (option->value_capacity == 0)
-        return ARGUS_ERROR_MEMORY;
-
     char  *endptr;
     double parsed_value = strtod(value, &endptr);
 
-    if (*endptr != '\0' || endptr == value)
+    if (*endptr != '\0' || endptr == value) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_VALUE,
+                            "Invalid float value '%s' for positional argument '%s'", value,
+                            option->name);
         return ARGUS_ERROR_INVALID_VALUE;
+    }
+    if (option->sink != NULL)
+        return sink_value(argus, option, (argus_value_t){.as_float = parsed_value});
+
+    adjust_array_size(argus, option);
+    if (option->value_capacity == 0)
+        return ARGUS_ERROR_MEMORY;
 
     option->value.as_array[option->value_count].as_float = parsed_value;
     option->value_count++;
@@ -35,15 +41,5 @@ static int set_float_value(argus_option_t *option, char *value)
 
 int variadic_float_handler(argus_t *argus, argus_option_t *option, char *value)
 {
-    int status = set_float_value(option, value);
-    if (status != ARGUS_SUCCESS) {
-        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_VALUE,
-                            "Invalid float value '%s' for positional argument '%s'", value,
-                            option->name);
-        return status;
-    }
-
-    apply_array_flags(option);
-    option->is_allocated = true;
-    return ARGUS_SUCCESS;
+    return set_float_value(argus, option, value);
 }
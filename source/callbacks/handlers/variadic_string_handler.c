@@ -18,38 +18,43 @@
 #include "argus/options.h"
 #include "argus/types.h"
 
-static int set_string_value(argus_option_t *option, char *value)
+static int set_string_value(argus_t *argus, argus_option_t *option, char *value)
 {
-    adjust_array_size(option);
+    if (option->sink != NULL)
+        return sink_value(argus, option, (argus_value_t){.as_string = value});
+
+    adjust_array_size(argus, option);
     if (option->value_capacity == 0)
         return ARGUS_ERROR_MEMORY;
 
-    char *dup_value = safe_strdup(value);
-    if (dup_value == NULL)
-        return ARGUS_ERROR_MEMORY;
+    // Borrowed values point straight into argv
+    char *stored = value;
+    if (!(option->flags & FLAG_BORROW)) {
+        stored = parse_strdup(argus, value);
+        if (stored == NULL)
+            return ARGUS_ERROR_MEMORY;
+    }
 
-    option->value.as_array[option->value_count].as_string = dup_value;
+    option->value.as_array[option->value_count].as_string = stored;
     option->value_count++;
     return ARGUS_SUCCESS;
 }
 
 int variadic_string_handler(argus_t *argus, argus_option_t *option, char *value)
 {
-    UNUSED(argus);
-
-    int status = set_string_value(option, value);
+    int status = set_string_value(argus, option, value);
     if (status != ARGUS_SUCCESS)
         return status;
 
-    apply_array_flags(option);
-    option->is_allocated = true;
     return ARGUS_SUCCESS;
 }
 
 int free_variadic_string_handler(argus_option_t *option)
 {
-    for (size_t i = 0; i < option->value_count; ++i)
-        free(option->value.as_array[i].as_string);
+    if (!(option->flags & FLAG_BORROW)) {
+        for (size_t i = 0; i < option->value_count; ++i)
+            free(option->value.as_array[i].as_string);
+    }
     free(option->value.as_array);
     return ARGUS_SUCCESS;
 }
@@ -84,6 +84,21 @@ int choices_float_validator(argus_t *argus, void *option_ptr, validator_data_t d
     return ARGUS_ERROR_INVALID_CHOICE;
 }
 
+int choices_enum_validator(argus_t *argus, void *option_ptr, validator_data_t data)
+{
+    argus_option_t *option  = (argus_option_t *)option_ptr;
+    choices_data_t *choices = &data.choices;
+
+    // enum_handler already matched parsed values, this only catches bad defaults
+    if (option->value.as_int64 >= 0 && (uint64_t)option->value.as_int64 < choices->count)
+        return ARGUS_SUCCESS;
+
+    ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_CHOICE,
+                        "Value '%" PRId64 "' is not the ordinal of one of the %zu choices",
+                        option->value.as_int64, choices->count);
+    return ARGUS_ERROR_INVALID_CHOICE;
+}
+
 char *format_choices_validator(validator_data_t data)
 {
     choices_data_t *choices      = &data.choices;
@@ -30,7 +30,8 @@ int count_validator(argus_t *argus, void *option_ptr, validator_data_t data)
         return ARGUS_ERROR_INVALID_RANGE;
     }
 
-    int64_t count = option->value_count;
+    // Values given to a sink are counted but never stored
+    int64_t count = option->sink != NULL ? option->sink_count : option->value_count;
 
     if (count < data.range.min || count > data.range.max) {
         ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_RANGE,
@@ -19,9 +19,137 @@
 #include "argus/internal/cross_platform.h"
 #include "argus/types.h"
 
+#ifdef ARGUS_REGEX
+
+/**
+ * regex_cache_entry_t - Pattern compiled for one context
+ */
+typedef struct regex_cache_entry_s
+{
+    const char       *pattern;    /* Pattern of the V_REGEX validator, compared by address */
+    pcre2_code       *code;       /* Compiled pattern, JIT-compiled when available */
+    pcre2_match_data *match_data; /* Reused by every match of the pattern */
+} regex_cache_entry_t;
+
+/**
+ * argus_regex_cache_s - Patterns compiled by the regex validators of a context
+ *
+ * Validators receive their data by value and may be shared by the results of
+ * a schema across threads, so compiled patterns live in the context instead.
+ */
+struct argus_regex_cache_s
+{
+    regex_cache_entry_t *entries;
+    size_t               count;
+    size_t               capacity;
+};
+
+static regex_cache_entry_t *find_compiled(const argus_regex_cache_t *cache, const char *pattern)
+{
+    if (cache == NULL)
+        return (NULL);
+    for (size_t i = 0; i < cache->count; ++i) {
+        if (cache->entries[i].pattern == pattern)
+            return (&cache->entries[i]);
+    }
+    return (NULL);
+}
+
+static regex_cache_entry_t *add_compiled(argus_t *argus, regex_cache_entry_t entry)
+{
+    argus_regex_cache_t *cache = argus->regex_cache;
+
+    if (cache == NULL) {
+        cache = calloc(1, sizeof(argus_regex_cache_t));
+        if (cache == NULL)
+            return (NULL);
+        argus->regex_cache = cache;
+    }
+    if (cache->count >= cache->capacity) {
+        size_t new_capacity = cache->capacity ? cache->capacity * 2 : 4;
+        void  *new_entries  = realloc(cache->entries, new_capacity * sizeof(regex_cache_entry_t));
+        if (new_entries == NULL)
+            return (NULL);
+        cache->entries  = new_entries;
+        cache->capacity = new_capacity;
+    }
+    cache->entries[cache->count] = entry;
+    return (&cache->entries[cache->count++]);
+}
+
+/**
+ * compile_pattern - Get the compiled form of a pattern, compiling it on first use
+ *
+ * @param argus     Argus context
+ * @param pattern   Regex pattern
+ * @param compiled  Receives the cache entry of the pattern
+ *
+ * @return Status code (0 for success, non-zero for error)
+ */
+static int compile_pattern(argus_t *argus, const char *pattern, regex_cache_entry_t **compiled)
+{
+    *compiled = find_compiled(argus->regex_cache, pattern);
+    if (*compiled != NULL)
+        return (ARGUS_SUCCESS);
+
+    int         errorcode;
+    PCRE2_SIZE  erroroffset;
+    pcre2_code *re = pcre2_compile((PCRE2_SPTR)pattern, PCRE2_ZERO_TERMINATED, 0, &errorcode,
+                                   &erroroffset, NULL);
+
+    if (re == NULL) {
+        PCRE2_UCHAR buffer[256];
+        pcre2_get_error_message(errorcode, buffer, sizeof(buffer));
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_FORMAT, "Failed to compile regex '%s': %s",
+                            pattern, buffer);
+        return (ARGUS_ERROR_INVALID_FORMAT);
+    }
+
+    // Without JIT support pcre2_match falls back to the interpreter
+    pcre2_jit_compile(re, PCRE2_JIT_COMPLETE);
+
+    regex_cache_entry_t entry = {
+        .pattern    = pattern,
+        .code       = re,
+        .match_data = pcre2_match_data_create_from_pattern(re, NULL),
+    };
+    if (entry.match_data != NULL)
+        *compiled = add_compiled(argus, entry);
+    if (*compiled == NULL) {
+        pcre2_match_data_free(entry.match_data);
+        pcre2_code_free(re);
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory for regex '%s'",
+                            pattern);
+        return (ARGUS_ERROR_MEMORY);
+    }
+    return (ARGUS_SUCCESS);
+}
+
+#endif
+
+void regex_cache_free(argus_t *argus)
+{
+#ifdef ARGUS_REGEX
+    argus_regex_cache_t *cache = argus->regex_cache;
+
+    if (cache == NULL)
+        return;
+    for (size_t i = 0; i < cache->count; ++i) {
+        pcre2_match_data_free(cache->entries[i].match_data);
+        pcre2_code_free(cache->entries[i].code);
+    }
+    free(cache->entries);
+    free(cache);
+#endif
+    argus->regex_cache = NULL;
+}
+
 /**
  * regex_validator - Validate a string value against a regular expression
  *
+ * The pattern is compiled the first time the context checks a value against
+ * it, then reused until argus_free.
+ *
  * @param argus  Argus context
  * @param value  String value to validate
  * @param data   Validator data containing regex pattern
@@ -43,24 +171,13 @@ int regex_validator(argus_t *argus, void *value_ptr, validator_data_t data)
         return ARGUS_ERROR_INVALID_VALUE;
     }
 
-    int         errorcode;
-    PCRE2_SIZE  erroroffset;
-    pcre2_code *re = pcre2_compile((PCRE2_SPTR)pattern, PCRE2_ZERO_TERMINATED, 0, &errorcode,
-                                   &erroroffset, NULL);
-
-    if (re == NULL) {
-        PCRE2_UCHAR buffer[256];
-        pcre2_get_error_message(errorcode, buffer, sizeof(buffer));
-        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_FORMAT, "Failed to compile regex '%s': %s",
-                            pattern, buffer);
-        return ARGUS_ERROR_INVALID_FORMAT;
-    }
-
-    pcre2_match_data *match_data = pcre2_match_data_create_from_pattern(re, NULL);
-    int rc = pcre2_match(re, (PCRE2_SPTR)value, PCRE2_ZERO_TERMINATED, 0, 0, match_data, NULL);
+    regex_cache_entry_t *compiled;
+    int                  status = compile_pattern(argus, pattern, &compiled);
+    if (status != ARGUS_SUCCESS)
+        return (status);
 
-    pcre2_match_data_free(match_data);
-    pcre2_code_free(re);
+    int rc = pcre2_match(compiled->code, (PCRE2_SPTR)value, PCRE2_ZERO_TERMINATED, 0, 0,
+                         compiled->match_data, NULL);
 
     if (rc < 0) {
         switch (rc) {
@@ -8,9 +8,56 @@
  */
 
 #include "argus/errors.h"
+#include "argus/internal/arena.h"
+#include "argus/internal/parsing.h"
+#include "argus/internal/utils.h"
 #include "argus/types.h"
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void touch_option(argus_t *argus, argus_option_t *option)
+{
+    argus_touched_t *touched = &argus->touched;
+
+    if (touched->overflow)
+        return;
+    if (touched->count > 0 && touched->options[touched->count - 1] == option)
+        return;
+
+    if (touched->count == touched->capacity) {
+        size_t           capacity = touched->capacity ? touched->capacity * 2 : 16;
+        argus_option_t **options  = realloc(touched->options, capacity * sizeof(*options));
+        if (options == NULL) {
+            touched->overflow = true;
+            return;
+        }
+        touched->options  = options;
+        touched->capacity = capacity;
+    }
+    touched->options[touched->count++] = option;
+}
+
+void touched_release(argus_t *argus)
+{
+    free(argus->touched.options);
+    argus->touched = (argus_touched_t){0};
+}
+
+char *borrow_copy(argus_t *argus, const char *value)
+{
+    argus_arena_t *arena = argus->arena;
+
+    if (arena == NULL) {
+        if (argus->env_arena == NULL)
+            argus->env_arena = arena_create(0);
+        arena = argus->env_arena;
+        if (arena == NULL)
+            return (NULL);
+    }
+    return (arena_strndup(arena, value, strlen(value)));
+}
 
 int execute_callbacks(argus_t *argus, argus_option_t *option, char *value)
 {
@@ -38,8 +85,10 @@ int execute_callbacks(argus_t *argus, argus_option_t *option, char *value)
         return (status);
 
     option->is_set = true;
-    if (option->value_count == 0)
+    touch_option(argus, option);
+    if (option->value_count == 0 && option->sink == NULL)
         option->value_count = 1;
+    bind_option_value(argus, option);
 
     if (option->flags & FLAG_EXIT)
         return (ARGUS_SHOULD_EXIT);
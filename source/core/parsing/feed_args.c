@@ -0,0 +1,270 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/errors.h"
+#include "argus/internal/parsing.h"
+#include "argus/internal/utils.h"
+#include "argus/options.h"
+#include "argus/types.h"
+
+/*
+ * Arguments are parsed by the same handlers as parse_args. An option token
+ * that needs the next argument is kept pending, then handed to its handler
+ * along with that argument as a two-entry argv. Values are only copied when
+ * their handler keeps pointing into them, the others are read in place.
+ */
+
+typedef enum
+{
+    ARG_NAMES_ONLY, /* Only names options, its text is not kept */
+    ARG_HAS_VALUE,  /* Holds the value of an option */
+    ARG_NEEDS_NEXT, /* Its last option takes the next argument as value */
+} arg_kind_t;
+
+static arg_kind_t long_kind(argus_t *argus, argus_option_t *options, const char *name,
+                            argus_option_t **option)
+{
+    const char *equal = strchr(name, '=');
+    size_t      len   = equal != NULL ? (size_t)(equal - name) : strlen(name);
+
+    *option = find_long_option(argus, options, name, len);
+    if (*option == NULL || (*option)->value_type == VALUE_TYPE_FLAG)
+        return (ARG_NAMES_ONLY);
+    return (equal != NULL ? ARG_HAS_VALUE : ARG_NEEDS_NEXT);
+}
+
+static arg_kind_t short_kind(argus_t *argus, argus_option_t *options, const char *names,
+                             argus_option_t **option)
+{
+    size_t len = strlen(names);
+
+    // Same walk as handle_short_option: the first option taking a value ends the cluster
+    for (size_t i = 0; i < len; ++i) {
+        *option = find_short_option(argus, options, names[i]);
+        if (*option == NULL)
+            return (ARG_NAMES_ONLY);
+        if ((*option)->value_type != VALUE_TYPE_FLAG)
+            return (i < len - 1 ? ARG_HAS_VALUE : ARG_NEEDS_NEXT);
+    }
+    *option = NULL;
+    return (ARG_NAMES_ONLY);
+}
+
+// Built-in handlers that parse or copy their value instead of pointing into it
+static const argus_handler_t value_readers[] = {
+    int_handler,          float_handler,          bool_handler,         flag_handler,
+    enum_handler,         help_handler,           version_handler,      array_string_handler,
+    array_int_handler,    array_float_handler,    map_string_handler,   map_int_handler,
+    map_float_handler,    map_bool_handler,       variadic_int_handler, variadic_float_handler,
+    variadic_string_handler,
+};
+
+// string_handler, borrowing options and custom handlers may keep the value itself,
+// a sink is done with it once it returns
+static bool keeps_arg(const argus_option_t *option)
+{
+    if (option == NULL || option->sink != NULL)
+        return (false);
+    if (option->flags & FLAG_BORROW)
+        return (true);
+    for (size_t i = 0; i < sizeof(value_readers) / sizeof(value_readers[0]); ++i) {
+        if (option->handler == value_readers[i])
+            return (false);
+    }
+    return (true);
+}
+
+// Values keep pointing into their argument, which the caller may reuse
+static char *keep_arg(argus_t *argus, const char *arg)
+{
+    char *copy = borrow_copy(argus, arg);
+    if (copy == NULL)
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+    return (copy);
+}
+
+static int set_pending(argus_t *argus, const char *arg)
+{
+    argus_feed_t *feed = &argus->feed;
+    size_t        size = strlen(arg) + 1;
+
+    if (size > feed->pending_size) {
+        char *pending = realloc(feed->pending, size);
+        if (pending == NULL) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+            return (ARGUS_ERROR_MEMORY);
+        }
+        feed->pending      = pending;
+        feed->pending_size = size;
+    }
+    memcpy(feed->pending, arg, size);
+    return (ARGUS_SUCCESS);
+}
+
+/**
+ * run_option - Hand an option argument to its handler
+ *
+ * @param argus      Argus context
+ * @param arg        Option argument, with its dashes
+ * @param next       Argument following it, NULL if there is none
+ * @param read_only  The value belongs to the caller and must not be cut in place
+ *
+ * @return Status code
+ */
+static int run_option(argus_t *argus, char *arg, char *next, bool read_only)
+{
+    argus_option_t *options    = argus->feed.options;
+    char           *argv[2]    = {arg, next};
+    int             argc       = next != NULL ? 2 : 1;
+    int             index      = 0;
+    bool            const_args = argus->const_args;
+    int             status;
+
+    argus->const_args = read_only;
+    if (arg[1] == '-')
+        status = handle_long_option(argus, options, arg + 2, argv, argc, &index);
+    else
+        status = handle_short_option(argus, options, arg + 1, argv, argc, &index);
+    argus->const_args = const_args;
+    return (status);
+}
+
+static int feed_positional(argus_t *argus, const char *arg)
+{
+    argus_feed_t   *feed       = &argus->feed;
+    char           *value      = (char *)arg;
+    bool            const_args = argus->const_args;
+    argus_option_t *option;
+    int             status;
+
+    option = find_positional_option(argus, feed->options, feed->positional_index);
+
+    bool kept = keeps_arg(option);
+    if (kept) {
+        value = keep_arg(argus, arg);
+        if (value == NULL)
+            return (ARGUS_ERROR_MEMORY);
+    }
+    argus->const_args = !kept;
+    status            = handle_positional(argus, feed->options, value, feed->positional_index++);
+    argus->const_args = const_args;
+    return (status);
+}
+
+static int feed_option(argus_t *argus, const char *arg)
+{
+    argus_feed_t   *feed = &argus->feed;
+    argus_option_t *option;
+    arg_kind_t      kind;
+
+    if (arg[1] == '-')
+        kind = long_kind(argus, feed->options, arg + 2, &option);
+    else
+        kind = short_kind(argus, feed->options, arg + 1, &option);
+
+    if (kind == ARG_NEEDS_NEXT) {
+        feed->pending_option = option;
+        return (set_pending(argus, arg));
+    }
+    if (kind == ARG_NAMES_ONLY || !keeps_arg(option))
+        return (run_option(argus, (char *)arg, NULL, true));
+
+    char *copy = keep_arg(argus, arg);
+    if (copy == NULL)
+        return (ARGUS_ERROR_MEMORY);
+    return (run_option(argus, copy, NULL, false));
+}
+
+static bool is_negative_number(argus_t *argus, const char *arg)
+{
+    const char     *digits = arg + 1;
+    argus_option_t *option;
+
+    if (!isdigit(digits[0]) && !(digits[0] == '.' && isdigit(digits[1])))
+        return (false);
+    option = find_positional_option(argus, argus->feed.options, argus->feed.positional_index);
+    return (option != NULL && (option->value_type & VALUE_TYPE_ANY_NUMERIC));
+}
+
+int feed_arg(argus_t *argus, const char *arg)
+{
+    argus_feed_t *feed = &argus->feed;
+
+    if (feed->options == NULL)
+        feed->options = argus->options;
+
+    if (feed->pending != NULL && feed->pending[0] != '\0') {
+        bool  kept  = keeps_arg(feed->pending_option);
+        char *value = kept ? keep_arg(argus, arg) : (char *)arg;
+        if (value == NULL)
+            return (ARGUS_ERROR_MEMORY);
+        int status       = run_option(argus, feed->pending, value, !kept);
+        feed->pending[0] = '\0';
+        return (status);
+    }
+
+    if (strcmp(arg, "--") == 0) {
+        feed->only_positional = true;
+        return (ARGUS_SUCCESS);
+    }
+    if (feed->only_positional)
+        return (feed_positional(argus, arg));
+    if (arg[0] == '-' && !is_negative_number(argus, arg))
+        return (feed_option(argus, arg));
+
+    argus_option_t *subcommand = NULL;
+    int             status     = find_subcommand(argus, feed->options, arg, &subcommand);
+    if (status != ARGUS_SUCCESS)
+        return (status);
+    if (subcommand != NULL) {
+        // Like parse_args, the rest of the command line belongs to the subcommand
+        enter_subcommand(argus, subcommand);
+        feed->options          = subcommand->sub_options;
+        feed->positional_index = 0;
+        return (ARGUS_SUCCESS);
+    }
+    return (feed_positional(argus, arg));
+}
+
+int feed_end(argus_t *argus)
+{
+    argus_feed_t *feed   = &argus->feed;
+    int           status = ARGUS_SUCCESS;
+
+    // Let the handler report the missing value
+    if (feed->pending != NULL && feed->pending[0] != '\0')
+        status = run_option(argus, feed->pending, NULL, false);
+
+    feed_clear(argus);
+    return (status);
+}
+
+void feed_clear(argus_t *argus)
+{
+    argus_feed_t *feed = &argus->feed;
+
+    // The pending buffer is kept for the next command line
+    if (feed->pending != NULL)
+        feed->pending[0] = '\0';
+    feed->options          = NULL;
+    feed->pending_option   = NULL;
+    feed->positional_index = 0;
+    feed->only_positional  = false;
+    feed->status           = ARGUS_SUCCESS;
+}
+
+void feed_release(argus_t *argus)
+{
+    free(argus->feed.pending);
+    argus->feed = (argus_feed_t){0};
+}
@@ -0,0 +1,41 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include "argus/internal/parsing.h"
+#include "argus/internal/utils.h"
+#include "argus/types.h"
+
+static void finalize_options(argus_t *argus, argus_option_t *options)
+{
+    for (int i = 0; options[i].type != TYPE_NONE; ++i) {
+        argus_option_t *option = &options[i];
+
+        if (!option->is_set || option->value_count <= 1)
+            continue;
+
+        if (option->value_type & (VALUE_TYPE_ARRAY | VALUE_TYPE_VARIADIC))
+            apply_array_flags(option);
+        else if (option->value_type & VALUE_TYPE_MAP)
+            apply_map_flags(option);
+        else
+            continue;
+        // FLAG_UNIQUE may have dropped values since the count was bound
+        bind_option_value(argus, option);
+    }
+}
+
+void finalize_collections(argus_t *argus)
+{
+    finalize_options(argus, argus->options);
+
+    for (size_t i = 0; i < argus->subcommand_depth; ++i) {
+        const argus_option_t *subcommand = argus->subcommand_stack[i];
+        finalize_options(argus, (argus_option_t *)subcommand->sub_options);
+    }
+}
@@ -7,120 +7,60 @@
  * See LICENSE file in the project root for full license information.
  */
 
-#include <ctype.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "argus/errors.h"
+#include "argus/internal/env_table.h"
 #include "argus/internal/parsing.h"
 #include "argus/types.h"
 
-/**
- * get_env_var_name - Get environment variable name for an option
- *
- * @param argus  Argus context
- * @param option Option to get env var name for
- *
- * @return Environment variable name or NULL if none
- */
-static const char *get_env_var_name(argus_t *argus, argus_option_t *option)
+static int load_env(argus_t *argus, const argus_env_table_t *table, const env_entry_t *entry)
 {
-    static char full_name[128];
-    const char *prefix           = argus->env_prefix ? argus->env_prefix : "";
-    size_t      prefix_len       = strlen(prefix);
-    bool        needs_underscore = prefix_len > 0 && prefix[prefix_len - 1] != '_';
+    argus_option_t *option    = entry->option;
+    char           *env_value = (char *)table->names[entry->name].value;
 
-    if (option->env_name) {
-        if (option->flags & FLAG_NO_ENV_PREFIX)
-            return (option->env_name);
+    if (env_value == NULL || (option->is_set && !(option->flags & FLAG_ENV_OVERRIDE)))
+        return (ARGUS_SUCCESS);
 
-        if (argus->env_prefix && strncmp(option->env_name, argus->env_prefix, prefix_len) == 0)
-            return (option->env_name);
+    bool          was_set   = option->is_set;
+    argus_value_t old_value = option->value;
 
-        if (needs_underscore) {
-            snprintf(full_name, sizeof(full_name), "%s_%s", prefix, option->env_name);
-        } else {
-            snprintf(full_name, sizeof(full_name), "%s%s", prefix, option->env_name);
-        }
-        return (full_name);
+    //! possible leak here
+    int status = execute_callbacks(argus, option, env_value);
+    if (status != ARGUS_SUCCESS && was_set) {
+        option->is_set = was_set;
+        option->value  = old_value;
     }
-
-    if (option->flags & FLAG_AUTO_ENV) {
-        const char *name = option->name ? option->name : (option->lname ? option->lname : "");
-
-        if (option->flags & FLAG_NO_ENV_PREFIX) {
-            snprintf(full_name, sizeof(full_name), "%s", name);
-        } else if (needs_underscore) {
-            snprintf(full_name, sizeof(full_name), "%s_%s", prefix, name);
-        } else {
-            snprintf(full_name, sizeof(full_name), "%s%s", prefix, name);
-        }
-
-        for (char *p = full_name; *p; ++p)
-            *p = *p == '-' ? '_' : (char)toupper(*p);
-        return (full_name);
-    }
-
-    return (NULL);
-}
-
-static int load_env(argus_t *argus, argus_option_t *options)
-{
-    for (int i = 0; options[i].type != TYPE_NONE; ++i) {
-        argus_option_t *option = &options[i];
-
-        if (option->type == TYPE_GROUP || option->type == TYPE_SUBCOMMAND)
-            continue;
-
-        if (option->is_set && !(option->flags & FLAG_ENV_OVERRIDE))
-            continue;
-
-        const char *env_name = get_env_var_name(argus, option);
-        if (!env_name)
-            continue;
-
-        char *env_value = getenv(env_name);
-        if (!env_value)
-            continue;
-
-        bool          was_set   = option->is_set;
-        argus_value_t old_value = option->value;
-
-        //! possible leak here
-        int status = execute_callbacks(argus, option, env_value);
-        if (status != ARGUS_SUCCESS) {
-            if (was_set) {
-                option->is_set = was_set;
-                option->value  = old_value;
-            }
-            return (status);
-        }
-    }
-    return (ARGUS_SUCCESS);
+    return (status);
 }
 
 /**
- * load_environment_variables - Load option values from environment variables
+ * load_env_vars - Load option values from environment variables
+ *
+ * Variable names of the active levels are hashed once and kept in the context,
+ * then matched in a single pass over the environment.
  *
- * @param argus   Argus context
- * @param options Options array to process
+ * @param argus  Argus context
  *
  * @return Status code (0 for success, non-zero for error)
  */
 int load_env_vars(argus_t *argus)
 {
-    int status = load_env(argus, argus->options);
-    if (status != ARGUS_SUCCESS)
-        return (status);
-
-    for (size_t i = 0; i < argus->subcommand_depth; ++i) {
-        const argus_option_t *subcommand = argus->subcommand_stack[i];
-        if (subcommand && subcommand->sub_options) {
-            status = load_env(argus, subcommand->sub_options);
-            if (status != ARGUS_SUCCESS)
-                return (status);
-        }
+    argus_env_table_t *table = env_table_get(argus);
+    if (table == NULL) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to index environment variables");
+        return (ARGUS_ERROR_MEMORY);
     }
-    return (ARGUS_SUCCESS);
+
+    // Borrowing options get a copy of the values they cut, never the environment itself
+    bool const_args   = argus->const_args;
+    int  status       = ARGUS_SUCCESS;
+    argus->const_args = true;
+
+    env_table_scan(table);
+    for (size_t i = 0; i < table->entry_count && status == ARGUS_SUCCESS; ++i)
+        status = load_env(argus, table, &table->entries[i]);
+    argus->const_args = const_args;
+    return (status);
 }
@@ -11,7 +11,6 @@
 #include <string.h>
 
 #include "argus/errors.h"
-#include "argus/internal/cross_platform.h"
 #include "argus/internal/parsing.h"
 #include "argus/internal/utils.h"
 #include "argus/types.h"
@@ -19,17 +18,14 @@
 int handle_long_option(argus_t *argus, argus_option_t *options, char *arg, char **argv, int argc,
                        int *current_index)
 {
-    char  option_name[64] = {0};
-    char *equal_pos       = strchr(arg, '=');
-    if (equal_pos != NULL) {
-        safe_strncpy(option_name, sizeof(option_name), arg, equal_pos - arg);
-    } else
-        safe_strncpy(option_name, sizeof(option_name), arg, sizeof(option_name) - 1);
+    char  *equal_pos  = strchr(arg, '=');
+    size_t name_len   = equal_pos != NULL ? (size_t)(equal_pos - arg) : strlen(arg);
+    int    name_width = name_len > 63 ? 63 : (int)name_len;
 
-    argus_option_t *option = find_option_by_lname(options, option_name);
+    argus_option_t *option = find_long_option(argus, options, arg, name_len);
     if (option == NULL) {
-        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_ARGUMENT, "Unknown option: '--%s'",
-                            option_name);
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_ARGUMENT, "Unknown option: '--%.*s'",
+                            name_width, arg);
         return ARGUS_ERROR_INVALID_ARGUMENT;
     }
 
@@ -42,7 +38,7 @@ int handle_long_option(argus_t *argus, argus_option_t *options, char *arg, char
             value = argv[*current_index];
         } else {
             ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MISSING_VALUE,
-                                "Missing value for option: '--%s'", option_name);
+                                "Missing value for option: '--%.*s'", name_width, arg);
             return ARGUS_ERROR_MISSING_VALUE;
         }
     }
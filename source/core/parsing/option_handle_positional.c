@@ -16,7 +16,7 @@
 
 int handle_positional(argus_t *argus, argus_option_t *options, char *value, int position)
 {
-    argus_option_t *option = find_positional(options, position);
+    argus_option_t *option = find_positional_option(argus, options, position);
     if (option == NULL) {
         ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_ARGUMENT, "Unknown positional: '%s'", value);
         return ARGUS_ERROR_INVALID_ARGUMENT;
@@ -23,7 +23,7 @@ int handle_short_option(argus_t *argus, argus_option_t *options, char *arg, char
     // Format "-abc"
     for (size_t i = 0; i < len; ++i) {
         char            option_char = arg[i];
-        argus_option_t *option      = find_option_by_sname(options, option_char);
+        argus_option_t *option      = find_short_option(argus, options, option_char);
         if (option == NULL) {
             ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_INVALID_ARGUMENT, "Unknown option: '-%c'",
                                 option_char);
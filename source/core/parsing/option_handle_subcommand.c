@@ -7,13 +7,21 @@
  * See LICENSE file in the project root for full license information.
  */
 
+#include "argus/internal/option_index.h"
 #include "argus/internal/parsing.h"
 #include "argus/types.h"
 
-int handle_subcommand(argus_t *argus, argus_option_t *option, int argc, char **argv)
+void enter_subcommand(argus_t *argus, argus_option_t *option)
 {
     option->is_set                                   = true;
     argus->subcommand_stack[argus->subcommand_depth] = option;
+    touch_option(argus, option);
     argus->subcommand_depth++;
+    index_activate(argus, option->sub_options);
+}
+
+int handle_subcommand(argus_t *argus, argus_option_t *option, int argc, char **argv)
+{
+    enter_subcommand(argus, option);
     return parse_args(argus, option->sub_options, argc, argv);
 }
@@ -8,38 +8,64 @@
  */
 
 #include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "argus/errors.h"
+#include "argus/internal/option_index.h"
 #include "argus/internal/parsing.h"
+#include "argus/internal/subcommand_trie.h"
 #include "argus/internal/utils.h"
 #include "argus/types.h"
 
+static int report_ambiguous_subcommand(argus_t *argus, const subcommand_trie_t *trie,
+                                       const subcommand_match_t *match, const char *name)
+{
+    argus_option_t **candidates = malloc(match->count * sizeof(argus_option_t *));
+    if (candidates == NULL) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+        return (ARGUS_ERROR_MEMORY);
+    }
+
+    size_t count = subcommand_trie_candidates(trie, match, candidates, match->count);
+    ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_AMBIGUOUS_SUBCOMMAND,
+                        "'%s' is ambigous and could match:", name);
+    for (size_t i = 0; i < count; ++i)
+        fprintf(stderr, "  '%s' - %s\n", candidates[i]->name, candidates[i]->help);
+    free(candidates);
+    return (ARGUS_ERROR_AMBIGUOUS_SUBCOMMAND);
+}
+
 int find_subcommand(argus_t *argus, argus_option_t *options, const char *name,
                     argus_option_t **result)
 {
-    argus_option_t *subcommand = NULL;
-
-    for (int i = 0; options[i].type != TYPE_NONE; ++i) {
-        if (options[i].type == TYPE_SUBCOMMAND && starts_with(name, options[i].name) != NULL) {
-            if (subcommand != NULL) {
-                ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_AMBIGUOUS_SUBCOMMAND,
-                                    "'%s' is ambigous and could match:\n"
-                                    "  '%s' - %s\n"
-                                    "  '%s' - %s",
-                                    name, subcommand->name, subcommand->help, options[i].name,
-                                    options[i].help);
-                return ARGUS_ERROR_AMBIGUOUS_SUBCOMMAND;
-            }
-            if (subcommand == NULL && strcmp(name, options[i].name) == 0) {
-                *result = &options[i];
-                return ARGUS_SUCCESS;
-            }
-            subcommand = &options[i];
-        }
+    argus_index_t           *index = index_get(argus, options);
+    const subcommand_trie_t *trie  = NULL;
+    subcommand_trie_t       *owned = NULL;
+
+    if (index != NULL)
+        trie = index_subcommands(index);
+    // Contexts without an index (or out of memory for it) use a temporary trie
+    if (trie == NULL)
+        trie = owned = subcommand_trie_build(options);
+    if (trie == NULL) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+        return (ARGUS_ERROR_MEMORY);
     }
-    *result = subcommand;
-    return ARGUS_SUCCESS;
+
+    subcommand_match_t match;
+    int                status = ARGUS_SUCCESS;
+
+    subcommand_trie_match(trie, name, &match);
+    *result = NULL;
+    // A schema trie is shared: take the subcommand at the same position in options
+    if (match.option != NULL)
+        *result = &options[match.option - trie->options];
+    if (match.count > 1)
+        status = report_ambiguous_subcommand(argus, trie, &match, name);
+    subcommand_trie_free(owned);
+    return (status);
 }
 
 int parse_args(argus_t *argus, argus_option_t *options, int argc, char **argv)
@@ -75,7 +101,7 @@ int parse_args(argus_t *argus, argus_option_t *options, int argc, char **argv)
         if (short_arg != NULL) {
             // Checking if this is a negative number or an option
             if (isdigit(short_arg[0]) || (short_arg[0] == '.' && isdigit(short_arg[1]))) {
-                argus_option_t *pos_opt = find_positional(options, positional_index);
+                argus_option_t *pos_opt = find_positional_option(argus, options, positional_index);
 
                 if (pos_opt && (pos_opt->value_type & VALUE_TYPE_ANY_NUMERIC)) {
                     status = handle_positional(argus, options, arg, positional_index++);
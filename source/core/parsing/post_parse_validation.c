@@ -7,13 +7,128 @@
  * See LICENSE file in the project root for full license information.
  */
 
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "argus/errors.h"
+#include "argus/internal/option_index.h"
 #include "argus/internal/utils.h"
 #include "argus/types.h"
 
+/* Levels up to this many options keep their set bitset on the stack */
+#define SET_BITS_LOCAL_WORDS 4
+
+/**
+ * level_deps_t - Dependency bitsets of a level, with the options currently set
+ */
+typedef struct level_deps_s
+{
+    const argus_index_t *index; /* NULL to visit every option and check dependencies by name */
+    uint64_t            *set;
+    uint64_t             local[SET_BITS_LOCAL_WORDS];
+} level_deps_t;
+
+/**
+ * group_state_t - Exclusive group the validated options currently belong to
+ */
+typedef struct group_state_s
+{
+    const char *name;
+    bool        exclusive; /* Members have to be tracked to find the conflict */
+    const char *first_set_option_name;
+    uint32_t    slot; /* Header position + 1 when visiting from the index */
+} group_state_t;
+
+// Position of the lowest bit set, bits must not be 0
+static size_t lowest_bit(uint64_t bits)
+{
+    static const unsigned char debruijn[64] = {
+        0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,  62, 55, 59, 36, 53, 51,
+        43, 22, 45, 39, 33, 30, 24, 18, 12, 5,  63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21,
+        44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6,
+    };
+
+    return (debruijn[((bits & (~bits + 1)) * 0x03f79d71b4cb0a89ULL) >> 58]);
+}
+
+static void set_bit(uint64_t *bits, size_t position)
+{
+    bits[position / 64] |= (uint64_t)1 << (position % 64);
+}
+
+/*
+ * The set bitset is filled from the options touched by the parse and the ones
+ * holding a default, so a short command line does not scan the whole level.
+ */
+static void load_level_deps(level_deps_t *deps, argus_t *argus, argus_option_t *options)
+{
+    deps->index = argus->touched.overflow ? NULL : index_find_level(argus, options);
+    deps->set   = deps->local;
+    if (deps->index == NULL)
+        return;
+
+    size_t words = deps->index->dependency_words;
+    if (words > SET_BITS_LOCAL_WORDS)
+        deps->set = malloc(words * sizeof(uint64_t));
+    if (deps->set == NULL) {
+        deps->index = NULL;
+        return;
+    }
+    memset(deps->set, 0, words * sizeof(uint64_t));
+
+    for (size_t i = 0; i < argus->touched.count; ++i) {
+        argus_option_t *option = argus->touched.options[i];
+        if (option >= options && option < options + deps->index->count && option->is_set)
+            set_bit(deps->set, (size_t)(option - options));
+    }
+    for (size_t w = 0; w < words; ++w) {
+        for (uint64_t bits = deps->index->visit_mask[w]; bits != 0; bits &= bits - 1) {
+            size_t position = w * 64 + lowest_bit(bits);
+            if (options[position].is_set)
+                set_bit(deps->set, position);
+        }
+    }
+}
+
+static void release_level_deps(level_deps_t *deps)
+{
+    if (deps->set != deps->local)
+        free(deps->set);
+}
+
+// Whether every option of mask is set
+static bool covers(const level_deps_t *deps, const uint64_t *mask)
+{
+    for (size_t w = 0; w < deps->index->dependency_words; ++w) {
+        if (mask[w] & ~deps->set[w])
+            return (false);
+    }
+    return (true);
+}
+
+// Whether at least `several ? 2 : 1` options of mask are set
+static bool intersects(const level_deps_t *deps, const uint64_t *mask, bool several)
+{
+    bool seen = false;
+
+    for (size_t w = 0; w < deps->index->dependency_words; ++w) {
+        uint64_t bits = mask[w] & deps->set[w];
+        if (bits == 0)
+            continue;
+        if (!several || seen || (bits & (bits - 1)) != 0)
+            return (true);
+        seen = true;
+    }
+    return (false);
+}
+
+static const uint64_t *mask_of(uint64_t *const *masks, size_t position)
+{
+    return (masks != NULL ? masks[position] : NULL);
+}
+
 static int validate_required(argus_t *argus, argus_option_t *options, argus_option_t *option)
 {
     if (option->require) {
@@ -61,51 +176,125 @@ static int call_validators(argus_t *argus, argus_option_t *option)
     return (ARGUS_SUCCESS);
 }
 
-static int validate_options_set(argus_t *argus, argus_option_t *options)
+/*
+ * With an index, dependencies are checked against the bitsets resolved when
+ * the level was indexed, and the lists are only walked by name to report an
+ * error, so messages and their order stay those of the name-based checks.
+ */
+static int validate_dependencies(argus_t *argus, const level_deps_t *deps,
+                                 argus_option_t *options, int position)
 {
-    const char *group_name                 = NULL;
-    bool        current_group_is_exclusive = false;
-    const char *first_set_option_name      = NULL;
+    argus_option_t *option = &options[position];
+    int             status;
 
-    for (int i = 0; options[i].type != TYPE_NONE; ++i) {
-        argus_option_t *option = &options[i];
+    if (deps->index == NULL) {
+        status = validate_required(argus, options, option);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+        return (validate_conflicts(argus, options, option));
+    }
 
-        if (option->type == TYPE_GROUP) {
-            group_name                 = option->name;
-            current_group_is_exclusive = option->flags & FLAG_EXCLUSIVE;
-            first_set_option_name      = NULL;
-            continue;
+    const uint64_t *require = mask_of(deps->index->require_masks, position);
+    if (require != NULL && !covers(deps, require)) {
+        status = validate_required(argus, options, option);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+    }
+
+    const uint64_t *conflict = mask_of(deps->index->conflict_masks, position);
+    if (conflict != NULL && intersects(deps, conflict, false))
+        return (validate_conflicts(argus, options, option));
+    return (ARGUS_SUCCESS);
+}
+
+// Only groups with two members set or more need their members tracked
+static bool group_needs_tracking(const level_deps_t *deps, const argus_option_t *group,
+                                 int position)
+{
+    if (!(group->flags & FLAG_EXCLUSIVE))
+        return (false);
+    if (deps->index == NULL)
+        return (true);
+
+    const uint64_t *members = mask_of(deps->index->group_masks, position);
+    return (members != NULL && intersects(deps, members, true));
+}
+
+static void enter_group(group_state_t *group, const level_deps_t *deps, argus_option_t *options,
+                        int position)
+{
+    group->name                  = options[position].name;
+    group->exclusive             = group_needs_tracking(deps, &options[position], position);
+    group->first_set_option_name = NULL;
+}
+
+static int validate_option(argus_t *argus, const level_deps_t *deps, group_state_t *group,
+                           argus_option_t *options, int position)
+{
+    argus_option_t *option = &options[position];
+
+    if (option->type == TYPE_POSITIONAL && (option->flags & FLAG_REQUIRED) && !option->is_set) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MISSING_REQUIRED,
+                            "Required positional argument missing: '%s'", option->name);
+        return (ARGUS_ERROR_MISSING_REQUIRED);
+    }
+
+    if (option->is_set) {
+        if (group->exclusive) {
+            if (group->first_set_option_name == NULL) {
+                group->first_set_option_name = option->name;
+            } else {
+                ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_EXCLUSIVE_GROUP,
+                                    "Exclusive options group '%s' conflict: '%s' and '%s'",
+                                    group->name, group->first_set_option_name, option->name);
+                return (ARGUS_ERROR_EXCLUSIVE_GROUP);
+            }
         }
 
-        if (option->type == TYPE_POSITIONAL && (option->flags & FLAG_REQUIRED) && !option->is_set) {
-            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MISSING_REQUIRED,
-                                "Required positional argument missing: '%s'", option->name);
-            return (ARGUS_ERROR_MISSING_REQUIRED);
+        int status = call_validators(argus, option);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+        return (validate_dependencies(argus, deps, options, position));
+    }
+    return (ARGUS_SUCCESS);
+}
+
+static int validate_every_option(argus_t *argus, const level_deps_t *deps, argus_option_t *options)
+{
+    group_state_t group = {0};
+
+    for (int i = 0; options[i].type != TYPE_NONE; ++i) {
+        if (options[i].type == TYPE_GROUP) {
+            enter_group(&group, deps, options, i);
+            continue;
         }
 
-        if (option->is_set) {
-            int status;
-
-            if (current_group_is_exclusive) {
-                if (first_set_option_name == NULL) {
-                    first_set_option_name = option->name;
-                } else {
-                    ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_EXCLUSIVE_GROUP,
-                                        "Exclusive options group '%s' conflict: '%s' and '%s'",
-                                        group_name, first_set_option_name, option->name);
-                    return (ARGUS_ERROR_EXCLUSIVE_GROUP);
-                }
-            }
+        int status = validate_option(argus, deps, &group, options, i);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+    }
+    return (ARGUS_SUCCESS);
+}
 
-            status = call_validators(argus, option);
-            if (status != ARGUS_SUCCESS)
-                return (status);
+// Visits set options and the ones always checked, in declaration order
+static int validate_indexed_options(argus_t *argus, const level_deps_t *deps,
+                                    argus_option_t *options)
+{
+    const argus_index_t *index = deps->index;
+    group_state_t        group = {0};
 
-            status = validate_required(argus, options, option);
-            if (status != ARGUS_SUCCESS)
-                return (status);
+    for (size_t w = 0; w < index->dependency_words; ++w) {
+        for (uint64_t bits = deps->set[w] | index->visit_mask[w]; bits != 0; bits &= bits - 1) {
+            int      position = (int)(w * 64 + lowest_bit(bits));
+            uint32_t slot     = index->group_slots != NULL ? index->group_slots[position] : 0;
+
+            if (slot != group.slot) {
+                group = (group_state_t){.slot = slot};
+                if (slot != 0)
+                    enter_group(&group, deps, options, (int)slot - 1);
+            }
 
-            status = validate_conflicts(argus, options, option);
+            int status = validate_option(argus, deps, &group, options, position);
             if (status != ARGUS_SUCCESS)
                 return (status);
         }
@@ -113,6 +302,20 @@ static int validate_options_set(argus_t *argus, argus_option_t *options)
     return (ARGUS_SUCCESS);
 }
 
+static int validate_options_set(argus_t *argus, argus_option_t *options)
+{
+    level_deps_t deps;
+    int          status;
+
+    load_level_deps(&deps, argus, options);
+    if (deps.index != NULL)
+        status = validate_indexed_options(argus, &deps, options);
+    else
+        status = validate_every_option(argus, &deps, options);
+    release_level_deps(&deps);
+    return (status);
+}
+
 int post_parse_validation(argus_t *argus)
 {
     int status;
@@ -0,0 +1,263 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "argus/errors.h"
+#include "argus/internal/response_files.h"
+#include "argus/internal/utils.h"
+#include "argus/types.h"
+
+#define RESPONSE_ARGV_INITIAL_CAPACITY 64
+
+typedef struct expand_state_s
+{
+    argus_t           *argus;
+    argus_responses_t *responses;
+    bool               only_positional; /* "--" was seen, the rest is taken literally */
+} expand_state_t;
+
+/*
+ * Reading files
+ */
+
+#if defined(_WIN32)
+
+static int read_file(const char *path, response_file_t *file)
+{
+    FILE *stream = fopen(path, "rb");
+    if (stream == NULL)
+        return (-1);
+
+    long size = -1;
+    if (fseek(stream, 0, SEEK_END) == 0)
+        size = ftell(stream);
+    if (size < 0 || fseek(stream, 0, SEEK_SET) != 0) {
+        fclose(stream);
+        return (-1);
+    }
+
+    file->size = (size_t)size + 1;
+    file->data = malloc(file->size);
+    if (file->data == NULL || fread(file->data, 1, (size_t)size, stream) != (size_t)size) {
+        free(file->data);
+        fclose(stream);
+        return (-1);
+    }
+    file->data[size] = '\0';
+    fclose(stream);
+    return (0);
+}
+
+static void release_file(response_file_t *file)
+{
+    free(file->data);
+}
+
+#else
+
+static int read_file(const char *path, response_file_t *file)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return (-1);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return (-1);
+    }
+
+    // Reserve one byte past the file so the last argument can be terminated in place,
+    // even when the file ends on a page boundary
+    file->size = (size_t)st.st_size + 1;
+    file->data = mmap(NULL, file->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                      0);
+    if (file->data == MAP_FAILED) {
+        close(fd);
+        return (-1);
+    }
+    if (st.st_size > 0 && mmap(file->data, (size_t)st.st_size, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(file->data, file->size);
+        close(fd);
+        return (-1);
+    }
+    close(fd);
+    return (0);
+}
+
+static void release_file(response_file_t *file)
+{
+    munmap(file->data, file->size);
+}
+
+#endif
+
+static response_file_t *open_file(expand_state_t *state, const char *path)
+{
+    argus_responses_t *responses = state->responses;
+
+    if (responses->file_count == responses->file_capacity) {
+        size_t           capacity = responses->file_capacity ? responses->file_capacity * 2 : 4;
+        response_file_t *files    = realloc(responses->files, capacity * sizeof(response_file_t));
+        if (files == NULL) {
+            ARGUS_PARSING_ERROR(state->argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+            return (NULL);
+        }
+        responses->files         = files;
+        responses->file_capacity = capacity;
+    }
+
+    response_file_t *file = &responses->files[responses->file_count];
+    *file                 = (response_file_t){0};
+    if (read_file(path, file) != 0) {
+        ARGUS_PARSING_ERROR(state->argus, ARGUS_ERROR_INVALID_ARGUMENT,
+                            "Cannot read response file '%s'", path);
+        return (NULL);
+    }
+    responses->file_count++;
+    return (file);
+}
+
+/*
+ * Expansion
+ */
+
+static int push_argument(expand_state_t *state, char *arg)
+{
+    argus_responses_t *responses = state->responses;
+
+    if (responses->argc == (size_t)INT_MAX) {
+        ARGUS_PARSING_ERROR(state->argus, ARGUS_ERROR_INVALID_ARGUMENT, "Too many arguments");
+        return (ARGUS_ERROR_INVALID_ARGUMENT);
+    }
+    if (responses->argc == responses->capacity) {
+        size_t capacity = responses->capacity ? responses->capacity * 2
+                                              : RESPONSE_ARGV_INITIAL_CAPACITY;
+        char **argv     = realloc(responses->argv, capacity * sizeof(char *));
+        if (argv == NULL) {
+            ARGUS_PARSING_ERROR(state->argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+            return (ARGUS_ERROR_MEMORY);
+        }
+        responses->argv     = argv;
+        responses->capacity = capacity;
+    }
+    responses->argv[responses->argc++] = arg;
+    return (ARGUS_SUCCESS);
+}
+
+static bool is_response_file(const expand_state_t *state, const char *arg)
+{
+    return (!state->only_positional && arg[0] == '@' && arg[1] != '\0');
+}
+
+static int expand_file(expand_state_t *state, const char *path, int depth);
+
+static int expand_argument(expand_state_t *state, char *arg, bool quoted, int depth)
+{
+    if (!quoted && is_response_file(state, arg))
+        return (expand_file(state, arg + 1, depth + 1));
+    // parse_args ends options at any "--" it receives, quoted or not
+    if (strcmp(arg, "--") == 0)
+        state->only_positional = true;
+    return (push_argument(state, arg));
+}
+
+static int expand_file(expand_state_t *state, const char *path, int depth)
+{
+    if (depth > MAX_RESPONSE_FILE_DEPTH) {
+        ARGUS_PARSING_ERROR(state->argus, ARGUS_ERROR_INVALID_ARGUMENT,
+                            "Response file '%s' is nested more than %d levels deep", path,
+                            MAX_RESPONSE_FILE_DEPTH);
+        return (ARGUS_ERROR_INVALID_ARGUMENT);
+    }
+
+    response_file_t *file = open_file(state, path);
+    if (file == NULL)
+        return (state->argus->error_code);
+
+    // The byte reserved past the file terminates the last argument
+    char *cursor = file->data;
+    char *end    = file->data + file->size - 1;
+    char *arg;
+    bool  quoted;
+    int   found;
+
+    while ((found = shell_word_next(&cursor, end, &arg, &quoted)) > 0) {
+        int status = expand_argument(state, arg, quoted, depth);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+    }
+    if (found < 0) {
+        ARGUS_PARSING_ERROR(state->argus, ARGUS_ERROR_INVALID_FORMAT,
+                            "Unterminated quote in response file '%s'", path);
+        return (ARGUS_ERROR_INVALID_FORMAT);
+    }
+    return (ARGUS_SUCCESS);
+}
+
+static bool has_response_file(int argc, char **argv)
+{
+    for (int i = 0; i < argc; ++i) {
+        if (strcmp(argv[i], "--") == 0)
+            return (false);
+        if (argv[i][0] == '@' && argv[i][1] != '\0')
+            return (true);
+    }
+    return (false);
+}
+
+int response_files_expand(argus_t *argus, int *argc, char ***argv)
+{
+    if (!has_response_file(*argc, *argv))
+        return (ARGUS_SUCCESS);
+
+    response_files_release(argus);
+    argus->responses = calloc(1, sizeof(argus_responses_t));
+    if (argus->responses == NULL) {
+        ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+        return (ARGUS_ERROR_MEMORY);
+    }
+
+    expand_state_t state = {.argus = argus, .responses = argus->responses};
+    for (int i = 0; i < *argc; ++i) {
+        int status = expand_argument(&state, (*argv)[i], false, 0);
+        if (status != ARGUS_SUCCESS)
+            return (status);
+    }
+
+    *argc = (int)argus->responses->argc;
+    *argv = argus->responses->argv;
+    return (ARGUS_SUCCESS);
+}
+
+void response_files_release(argus_t *argus)
+{
+    argus_responses_t *responses = argus->responses;
+
+    if (responses == NULL)
+        return;
+    for (size_t i = 0; i < responses->file_count; ++i)
+        release_file(&responses->files[i]);
+    free(responses->files);
+    free(responses->argv);
+    free(responses);
+    argus->responses = NULL;
+}
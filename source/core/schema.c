@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/option_index.h"
+#include "argus/internal/schema.h"
+#include "argus/types.h"
+
+static size_t count_records(const argus_option_t *options)
+{
+    size_t count = 0;
+
+    while (options[count].type != TYPE_NONE)
+        count++;
+    return (count + 1);
+}
+
+static long find_declared_level(const argus_schema_t *schema, const argus_option_t *options)
+{
+    for (size_t i = 0; i < schema->level_count; ++i) {
+        if (schema->levels[i].declared == options)
+            return ((long)i);
+    }
+    return (-1);
+}
+
+static int add_level(argus_schema_t *schema, argus_option_t *options, size_t *capacity)
+{
+    if (schema->level_count == *capacity) {
+        size_t          new_capacity = *capacity * 2;
+        schema_level_t *levels = realloc(schema->levels, new_capacity * sizeof(schema_level_t));
+        if (levels == NULL)
+            return (-1);
+        schema->levels = levels;
+        *capacity      = new_capacity;
+    }
+    schema->levels[schema->level_count++] = (schema_level_t){
+        .declared = options,
+        .offset   = schema->record_count,
+        .length   = count_records(options),
+    };
+    schema->record_count += schema->levels[schema->level_count - 1].length;
+    return (0);
+}
+
+// Breadth-first walk of the subcommands, each options array becoming one level
+static int collect_levels(argus_schema_t *schema, argus_option_t *options)
+{
+    size_t capacity = 4;
+
+    schema->levels = malloc(capacity * sizeof(schema_level_t));
+    if (schema->levels == NULL || add_level(schema, options, &capacity) != 0)
+        return (-1);
+
+    for (size_t level = 0; level < schema->level_count; ++level) {
+        argus_option_t *declared = schema->levels[level].declared;
+
+        for (size_t i = 0; declared[i].type != TYPE_NONE; ++i) {
+            argus_option_t *sub_options = declared[i].sub_options;
+            if (declared[i].type != TYPE_SUBCOMMAND || sub_options == NULL)
+                continue;
+            schema->link_count++;
+            if (find_declared_level(schema, sub_options) < 0 &&
+                add_level(schema, sub_options, &capacity) != 0)
+                return (-1);
+        }
+    }
+    return (0);
+}
+
+static int flatten_levels(argus_schema_t *schema)
+{
+    size_t link = 0;
+
+    schema->records = malloc(schema->record_count * sizeof(argus_option_t));
+    schema->links   = malloc((schema->link_count + 1) * sizeof(schema_link_t));
+    if (schema->records == NULL || schema->links == NULL)
+        return (-1);
+
+    for (size_t level = 0; level < schema->level_count; ++level) {
+        const schema_level_t *current = &schema->levels[level];
+
+        memcpy(&schema->records[current->offset], current->declared,
+               current->length * sizeof(argus_option_t));
+        for (size_t i = 0; i < current->length; ++i) {
+            const argus_option_t *option = &current->declared[i];
+            if (option->type != TYPE_SUBCOMMAND || option->sub_options == NULL)
+                continue;
+            schema->links[link++] = (schema_link_t){
+                .position = current->offset + i,
+                .level    = (size_t)find_declared_level(schema, option->sub_options),
+            };
+        }
+    }
+
+    for (size_t i = 0; i < schema->link_count; ++i) {
+        const schema_link_t *current = &schema->links[i];
+        schema->records[current->position].sub_options =
+            &schema->records[schema->levels[current->level].offset];
+    }
+    return (0);
+}
+
+static int build_indexes(argus_schema_t *schema)
+{
+    for (size_t level = 0; level < schema->level_count; ++level) {
+        schema_level_t *current = &schema->levels[level];
+
+        // Tries are built now: a shared schema is never written while parsing
+        current->index = index_build(&schema->records[current->offset]);
+        if (current->index == NULL || index_subcommands(current->index) == NULL)
+            return (-1);
+    }
+    return (0);
+}
+
+argus_schema_t *schema_compile(argus_option_t *options, const char *program_name,
+                               const char *version)
+{
+    argus_schema_t *schema = calloc(1, sizeof(argus_schema_t));
+    if (schema == NULL)
+        return (NULL);
+
+    schema->program_name = program_name;
+    schema->version      = version;
+    if (collect_levels(schema, options) != 0 || flatten_levels(schema) != 0 ||
+        build_indexes(schema) != 0) {
+        schema_release(schema);
+        return (NULL);
+    }
+    return (schema);
+}
+
+void schema_release(argus_schema_t *schema)
+{
+    if (schema == NULL)
+        return;
+    if (schema->levels != NULL) {
+        for (size_t i = 0; i < schema->level_count; ++i)
+            index_free(schema->levels[i].index);
+    }
+    free(schema->levels);
+    free(schema->records);
+    free(schema->links);
+    free(schema);
+}
+
+argus_option_t *schema_instantiate(const argus_schema_t *schema)
+{
+    argus_option_t *storage = malloc(schema->record_count * sizeof(argus_option_t));
+    if (storage == NULL)
+        return (NULL);
+
+    memcpy(storage, schema->records, schema->record_count * sizeof(argus_option_t));
+    for (size_t i = 0; i < schema->link_count; ++i) {
+        const schema_link_t *link = &schema->links[i];
+        storage[link->position].sub_options = &storage[schema->levels[link->level].offset];
+    }
+    return (storage);
+}
+
+const schema_level_t *schema_find_level(const argus_schema_t *schema,
+                                        const argus_option_t *storage,
+                                        const argus_option_t *options)
+{
+    if (options < storage || options >= storage + schema->record_count)
+        return (NULL);
+
+    size_t offset = (size_t)(options - storage);
+    size_t low    = 0;
+    size_t high   = schema->level_count;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (schema->levels[middle].offset < offset)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if (low < schema->level_count && schema->levels[low].offset == offset)
+        return (&schema->levels[low]);
+    return (NULL);
+}
@@ -8,8 +8,10 @@
  */
 
 #include "argus/errors.h"
+#include "argus/internal/choice_table.h"
 #include "argus/internal/stream.h"
 #include "argus/internal/utils.h"
+#include "argus/options.h"
 #include "argus/types.h"
 #include <stddef.h>
 #include <stdlib.h>
@@ -48,6 +50,57 @@ static int validate_default_value(argus_t *argus, argus_option_t *option)
     return (status);
 }
 
+static int validate_binding(argus_option_t *option)
+{
+    size_t size = option->bind_size;
+    bool   valid;
+
+    if (size == 0)
+        return (ARGUS_SUCCESS);
+
+    if (option->value_type & (VALUE_TYPE_INT | VALUE_TYPE_ANY_BOOL))
+        valid = size == 1 || size == 2 || size == 4 || size == 8;
+    else if (option->value_type & VALUE_TYPE_FLOAT)
+        valid = size == sizeof(float) || size == sizeof(double);
+    else
+        valid = size == sizeof(void *);
+
+    if (!valid) {
+        ARGUS_STRUCT_ERROR(option, "Bound field size %zu does not fit the option value type",
+                           size);
+        return (ARGUS_ERROR_INVALID_TYPE);
+    }
+
+    size = option->bind_count_size;
+    if (size == 0)
+        return (ARGUS_SUCCESS);
+    if (!(option->value_type & (VALUE_TYPE_ARRAY | VALUE_TYPE_MAP | VALUE_TYPE_VARIADIC))) {
+        ARGUS_STRUCT_ERROR(option, "Only arrays, maps and variadic values bind a count");
+        return (ARGUS_ERROR_INVALID_TYPE);
+    }
+    if (size != 1 && size != 2 && size != 4 && size != 8) {
+        ARGUS_STRUCT_ERROR(option, "Bound count size %zu is not an integer size", size);
+        return (ARGUS_ERROR_INVALID_TYPE);
+    }
+    return (ARGUS_SUCCESS);
+}
+
+static int validate_sink(argus_option_t *option)
+{
+    if (option->sink == NULL)
+        return (ARGUS_SUCCESS);
+
+    if (!(option->value_type & (VALUE_TYPE_ARRAY | VALUE_TYPE_VARIADIC))) {
+        ARGUS_STRUCT_ERROR(option, "Only array options and POSITIONAL_MANY can have a sink");
+        return (ARGUS_ERROR_INVALID_TYPE);
+    }
+    if (option->flags & (FLAG_SORTED | FLAG_UNIQUE)) {
+        ARGUS_STRUCT_ERROR(option, "Values given to a sink cannot be sorted or unique");
+        return (ARGUS_ERROR_INVALID_FLAG);
+    }
+    return (ARGUS_SUCCESS);
+}
+
 static int validate_dependencies(argus_option_t *options, argus_option_t *option)
 {
     int status = ARGUS_SUCCESS;
@@ -114,6 +167,10 @@ int validate_option(argus_t *argus, argus_option_t *options, argus_option_t *opt
         ARGUS_STRUCT_ERROR(option, "Option must have a handler");
         status = ARGUS_ERROR_INVALID_HANDLER;
     }
+    if (option->handler == enum_handler && enum_choices(option) == NULL) {
+        ARGUS_STRUCT_ERROR(option, "Enum option must have a V_CHOICE_ENUM validator");
+        status = ARGUS_ERROR_INVALID_HANDLER;
+    }
 
     if (validate_default_value(argus, option) != ARGUS_SUCCESS)
         status = ARGUS_ERROR_MALFORMED_OPTION;
@@ -121,6 +178,12 @@ int validate_option(argus_t *argus, argus_option_t *options, argus_option_t *opt
     if (validate_dependencies(options, option) != ARGUS_SUCCESS)
         status = ARGUS_ERROR_MALFORMED_OPTION;
 
+    if (validate_binding(option) != ARGUS_SUCCESS)
+        status = ARGUS_ERROR_MALFORMED_OPTION;
+
+    if (validate_sink(option) != ARGUS_SUCCESS)
+        status = ARGUS_ERROR_MALFORMED_OPTION;
+
     return (status);
 }
 
@@ -168,5 +231,11 @@ int validate_positional(argus_t *argus, argus_option_t *option)
         status = ARGUS_ERROR_INVALID_DEPENDENCY;
     }
 
+    if (validate_binding(option) != ARGUS_SUCCESS)
+        status = ARGUS_ERROR_MALFORMED_OPTION;
+
+    if (validate_sink(option) != ARGUS_SUCCESS)
+        status = ARGUS_ERROR_MALFORMED_OPTION;
+
     return (status);
 }
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "argus/internal/choice_table.h"
 #include "argus/internal/cross_platform.h"
 #include "argus/internal/display.h"
 #include "argus/internal/help.h"
@@ -267,10 +268,18 @@ static char *append_default_info(char *description, const argus_option_t *option
     snprintf(default_buf, sizeof(default_buf), " (default: ");
     size_t default_len = strlen(default_buf);
 
+    const choices_data_t *choices = enum_choices(option);
     switch (option->value_type) {
         case VALUE_TYPE_INT:
-            snprintf(default_buf + default_len, sizeof(default_buf) - default_len, "%d)",
-                     option->default_value.as_int);
+            // Enum defaults are ordinals, show the choice they stand for
+            if (choices != NULL && option->default_value.as_int64 >= 0 &&
+                (size_t)option->default_value.as_int64 < choices->count) {
+                snprintf(default_buf + default_len, sizeof(default_buf) - default_len, "\"%s\")",
+                         choices->as_strings[option->default_value.as_int64]);
+            } else {
+                snprintf(default_buf + default_len, sizeof(default_buf) - default_len, "%d)",
+                         option->default_value.as_int);
+            }
             break;
         case VALUE_TYPE_STRING:
             if (option->default_value.as_string) {
@@ -323,7 +332,8 @@ static char *append_validator_info(char *description, argus_t *argus, const argu
                                  validator_desc);
                     } else if (validator->func == choices_string_validator ||
                                validator->func == choices_int_validator ||
-                               validator->func == choices_float_validator) {
+                               validator->func == choices_float_validator ||
+                               validator->func == choices_enum_validator) {
                         snprintf(validator_info, sizeof(validator_info), " [%s]", validator_desc);
                     } else if (validator->func == length_validator) {
                         snprintf(validator_info, sizeof(validator_info), " (%s)", validator_desc);
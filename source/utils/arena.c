@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#define _GNU_SOURCE  // NOLINT
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/arena.h"
+#include "argus/internal/cross_platform.h"
+#include "argus/internal/utils.h"
+
+static size_t align_size(size_t size)
+{
+    size_t alignment = _Alignof(max_align_t);
+
+    return ((size + alignment - 1) & ~(alignment - 1));
+}
+
+static arena_block_t *new_block(size_t size)
+{
+    arena_block_t *block = malloc(sizeof(arena_block_t) + size);
+    if (block == NULL)
+        return (NULL);
+
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return (block);
+}
+
+argus_arena_t *arena_create(size_t block_size)
+{
+    argus_arena_t *arena = calloc(1, sizeof(argus_arena_t));
+    if (arena == NULL)
+        return (NULL);
+
+    arena->block_size = align_size(block_size != 0 ? block_size : ARENA_DEFAULT_BLOCK_SIZE);
+    return (arena);
+}
+
+void arena_destroy(argus_arena_t *arena)
+{
+    if (arena == NULL)
+        return;
+
+    arena_block_t *block = arena->first;
+    while (block != NULL) {
+        arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+void arena_reset(argus_arena_t *arena)
+{
+    arena->current = arena->first;
+    arena->last    = NULL;
+    if (arena->first != NULL)
+        arena->first->used = 0;
+}
+
+// Move to a block with room for size bytes, reusing the blocks kept by a reset
+static arena_block_t *next_block(argus_arena_t *arena, size_t size)
+{
+    arena_block_t *current = arena->current;
+
+    if (current != NULL && current->next != NULL && current->next->size >= size) {
+        current->next->used = 0;
+        return (current->next);
+    }
+
+    arena_block_t *block = new_block(size > arena->block_size ? size : arena->block_size);
+    if (block == NULL)
+        return (NULL);
+    if (current == NULL) {
+        arena->first = block;
+    } else {
+        block->next   = current->next;
+        current->next = block;
+    }
+    return (block);
+}
+
+void *arena_alloc(argus_arena_t *arena, size_t size)
+{
+    size = align_size(size);
+
+    arena_block_t *block = arena->current;
+    if (block == NULL || block->size - block->used < size) {
+        block = next_block(arena, size);
+        if (block == NULL)
+            return (NULL);
+        arena->current = block;
+    }
+
+    void *ptr = (char *)block->data + block->used;
+    block->used += size;
+    arena->last = ptr;
+    return (ptr);
+}
+
+void *arena_realloc(argus_arena_t *arena, void *ptr, size_t old_size, size_t new_size)
+{
+    if (ptr == NULL)
+        return (arena_alloc(arena, new_size));
+    if (new_size <= old_size)
+        return (ptr);
+
+    // The last allocation of the block grows without moving
+    arena_block_t *block = arena->current;
+    if (ptr == arena->last) {
+        size_t offset = (size_t)((char *)ptr - (char *)block->data);
+        size_t size   = align_size(new_size);
+        if (block->size - offset >= size) {
+            block->used = offset + size;
+            return (ptr);
+        }
+    }
+
+    void *new = arena_alloc(arena, new_size);
+    if (new == NULL)
+        return (NULL);
+    memcpy(new, ptr, old_size);
+    return (new);
+}
+
+char *arena_strndup(argus_arena_t *arena, const char *str, size_t len)
+{
+    char *copy = arena_alloc(arena, len + 1);
+    if (copy == NULL)
+        return (NULL);
+
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return (copy);
+}
+
+void *parse_alloc(argus_t *argus, size_t size)
+{
+    if (argus->arena != NULL)
+        return (arena_alloc(argus->arena, size));
+    return (malloc(size));
+}
+
+void *parse_realloc(argus_t *argus, void *ptr, size_t old_size, size_t new_size)
+{
+    if (argus->arena != NULL)
+        return (arena_realloc(argus->arena, ptr, old_size, new_size));
+    return (realloc(ptr, new_size));
+}
+
+char *parse_strndup(argus_t *argus, const char *str, size_t len)
+{
+    if (argus->arena != NULL)
+        return (arena_strndup(argus->arena, str, len));
+    return (safe_strndup(str, len));
+}
+
+char *parse_strdup(argus_t *argus, const char *str)
+{
+    return (parse_strndup(argus, str, strlen(str)));
+}
+
+void parse_release(argus_t *argus, void *ptr)
+{
+    // Arena memory is only given back by a reset
+    if (argus->arena == NULL)
+        free(ptr);
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/choice_table.h"
+#include "argus/internal/utils.h"
+#include "argus/options.h"
+#include "argus/types.h"
+
+choice_table_t *choice_table_build(const choices_data_t *choices)
+{
+    choice_table_t *table = calloc(1, sizeof(choice_table_t));
+    if (table == NULL)
+        return (NULL);
+
+    size_t size    = hash_table_size(choices->count);
+    table->choices = choices;
+    table->slots   = calloc(size, sizeof(uint32_t));
+    if (table->slots == NULL) {
+        free(table);
+        return (NULL);
+    }
+    table->mask = size - 1;
+
+    for (size_t i = 0; i < choices->count; ++i) {
+        const char *choice = choices->as_strings[i];
+        size_t      slot   = hash_string(choice, strlen(choice)) & table->mask;
+
+        while (table->slots[slot] != 0) {
+            // Keep the first declaration, like the linear lookup does
+            if (strcmp(choices->as_strings[table->slots[slot] - 1], choice) == 0)
+                break;
+            slot = (slot + 1) & table->mask;
+        }
+        if (table->slots[slot] == 0)
+            table->slots[slot] = (uint32_t)(i + 1);
+    }
+    return (table);
+}
+
+void choice_table_free(choice_table_t *table)
+{
+    if (table == NULL)
+        return;
+    free(table->slots);
+    free(table);
+}
+
+int choice_table_find(const choice_table_t *table, const char *value)
+{
+    size_t slot = hash_string(value, strlen(value)) & table->mask;
+
+    while (table->slots[slot] != 0) {
+        uint32_t ordinal = table->slots[slot] - 1;
+        if (strcmp(table->choices->as_strings[ordinal], value) == 0)
+            return ((int)ordinal);
+        slot = (slot + 1) & table->mask;
+    }
+    return (-1);
+}
+
+const choices_data_t *enum_choices(const argus_option_t *option)
+{
+    if (option->validators == NULL)
+        return (NULL);
+
+    for (size_t i = 0; option->validators[i] != NULL; ++i) {
+        if (option->validators[i]->func == choices_enum_validator)
+            return (&option->validators[i]->data.choices);
+    }
+    return (NULL);
+}
@@ -0,0 +1,239 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/env_table.h"
+#include "argus/internal/utils.h"
+#include "argus/types.h"
+
+#if defined(_WIN32)
+    #define environ _environ
+
+// Variable names are case insensitive on Windows, as getenv finds them
+static uint32_t env_hash(const char *name, size_t len)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= (unsigned char)toupper((unsigned char)name[i]);
+        hash *= 16777619u;
+    }
+    return (hash);
+}
+
+static bool env_name_equal(const char *a, const char *b, size_t len)
+{
+    return (_strnicmp(a, b, len) == 0);
+}
+#else
+extern char **environ;
+
+static uint32_t env_hash(const char *name, size_t len)
+{
+    return (hash_string(name, len));
+}
+
+static bool env_name_equal(const char *a, const char *b, size_t len)
+{
+    return (memcmp(a, b, len) == 0);
+}
+#endif
+
+// Copy src to dst when there is one, and return the length it takes
+static size_t append(char *dst, size_t pos, const char *src, size_t len)
+{
+    if (dst != NULL)
+        memcpy(dst + pos, src, len);
+    return (pos + len);
+}
+
+size_t env_name_format(const argus_t *argus, const argus_option_t *option, char *dst)
+{
+    const char *prefix           = argus->env_prefix ? argus->env_prefix : "";
+    size_t      prefix_len       = strlen(prefix);
+    bool        needs_underscore = prefix_len > 0 && prefix[prefix_len - 1] != '_';
+    const char *name             = option->env_name;
+    size_t      len              = 0;
+
+    if (option->type == TYPE_GROUP || option->type == TYPE_SUBCOMMAND)
+        return (0);
+    if (name == NULL && !(option->flags & FLAG_AUTO_ENV))
+        return (0);
+
+    if (name != NULL) {
+        // Explicit names already holding the prefix are used as they are
+        bool prefixed = argus->env_prefix && strncmp(name, argus->env_prefix, prefix_len) == 0;
+        if (!(option->flags & FLAG_NO_ENV_PREFIX) && !prefixed) {
+            len = append(dst, len, prefix, prefix_len);
+            if (needs_underscore)
+                len = append(dst, len, "_", 1);
+        }
+        len = append(dst, len, name, strlen(name));
+        if (dst != NULL)
+            dst[len] = '\0';
+        return (len);
+    }
+
+    name = option->name ? option->name : (option->lname ? option->lname : "");
+    if (!(option->flags & FLAG_NO_ENV_PREFIX)) {
+        len = append(dst, len, prefix, prefix_len);
+        if (needs_underscore)
+            len = append(dst, len, "_", 1);
+    }
+    len = append(dst, len, name, strlen(name));
+    if (dst != NULL) {
+        dst[len] = '\0';
+        for (char *p = dst; *p; ++p)
+            *p = *p == '-' ? '_' : (char)toupper(*p);
+    }
+    return (len);
+}
+
+static size_t collect_levels(const argus_t *argus, argus_option_t **levels)
+{
+    size_t count = 0;
+
+    levels[count++] = argus->options;
+    for (size_t i = 0; i < argus->subcommand_depth; ++i) {
+        const argus_option_t *subcommand = argus->subcommand_stack[i];
+        if (subcommand && subcommand->sub_options)
+            levels[count++] = subcommand->sub_options;
+    }
+    return (count);
+}
+
+static bool table_matches(const argus_env_table_t *table, const argus_t *argus)
+{
+    argus_option_t *levels[MAX_SUBCOMMAND_DEPTH + 1];
+    size_t          level_count = collect_levels(argus, levels);
+    const char     *prefix      = argus->env_prefix ? argus->env_prefix : "";
+
+    if (strcmp(table->prefix, prefix) != 0 || table->level_count != level_count)
+        return (false);
+    return (memcmp(table->levels, levels, level_count * sizeof(*levels)) == 0);
+}
+
+static uint32_t *find_slot(const argus_env_table_t *table, const char *name, size_t len)
+{
+    size_t slot = env_hash(name, len) & table->mask;
+
+    while (table->slots[slot] != 0) {
+        const env_name_t *entry = &table->names[table->slots[slot] - 1];
+        if (entry->len == len && env_name_equal(entry->name, name, len))
+            break;
+        slot = (slot + 1) & table->mask;
+    }
+    return (&table->slots[slot]);
+}
+
+static void add_entry(argus_env_table_t *table, argus_option_t *option, char *name, size_t len)
+{
+    uint32_t *slot = find_slot(table, name, len);
+
+    // Options sharing a variable share its name
+    if (*slot == 0) {
+        table->names[table->name_count] = (env_name_t){.name = name, .len = len};
+        *slot                           = (uint32_t)++table->name_count;
+    }
+    table->entries[table->entry_count++] = (env_entry_t){.option = option, .name = *slot - 1};
+}
+
+static argus_env_table_t *env_table_build(const argus_t *argus)
+{
+    argus_env_table_t *table = calloc(1, sizeof(argus_env_table_t));
+    if (table == NULL)
+        return (NULL);
+    table->level_count = collect_levels(argus, table->levels);
+
+    const char *prefix     = argus->env_prefix ? argus->env_prefix : "";
+    size_t      prefix_len = strlen(prefix);
+    size_t      size       = prefix_len + 1;
+    size_t      count      = 0;
+
+    for (size_t l = 0; l < table->level_count; ++l) {
+        for (const argus_option_t *option = table->levels[l]; option->type != TYPE_NONE;
+             ++option) {
+            size_t len = env_name_format(argus, option, NULL);
+            if (len == 0)
+                continue;
+            size += len + 1;
+            count++;
+        }
+    }
+
+    size_t slot_count = hash_table_size(count);
+    table->buffer     = malloc(size);
+    table->entries    = malloc((count ? count : 1) * sizeof(env_entry_t));
+    table->names      = malloc((count ? count : 1) * sizeof(env_name_t));
+    table->slots      = calloc(slot_count, sizeof(uint32_t));
+    if (table->buffer == NULL || table->entries == NULL || table->names == NULL ||
+        table->slots == NULL) {
+        env_table_free(table);
+        return (NULL);
+    }
+    table->mask = slot_count - 1;
+
+    memcpy(table->buffer, prefix, prefix_len + 1);
+    table->prefix = table->buffer;
+
+    char *name = table->buffer + prefix_len + 1;
+    for (size_t l = 0; l < table->level_count; ++l) {
+        for (argus_option_t *option = table->levels[l]; option->type != TYPE_NONE; ++option) {
+            size_t len = env_name_format(argus, option, name);
+            if (len == 0)
+                continue;
+            add_entry(table, option, name, len);
+            name += len + 1;
+        }
+    }
+    return (table);
+}
+
+argus_env_table_t *env_table_get(argus_t *argus)
+{
+    if (argus->env_table != NULL && table_matches(argus->env_table, argus))
+        return (argus->env_table);
+
+    env_table_free(argus->env_table);
+    argus->env_table = env_table_build(argus);
+    return (argus->env_table);
+}
+
+void env_table_scan(argus_env_table_t *table)
+{
+    for (size_t i = 0; i < table->name_count; ++i)
+        table->names[i].value = NULL;
+    if (table->name_count == 0 || environ == NULL)
+        return;
+
+    for (char **env = environ; *env != NULL; ++env) {
+        const char *separator = strchr(*env, '=');
+        if (separator == NULL)
+            continue;
+
+        uint32_t slot = *find_slot(table, *env, (size_t)(separator - *env));
+        if (slot != 0 && table->names[slot - 1].value == NULL)
+            table->names[slot - 1].value = separator + 1;
+    }
+}
+
+void env_table_free(argus_env_table_t *table)
+{
+    if (table == NULL)
+        return;
+    free(table->entries);
+    free(table->names);
+    free(table->slots);
+    free(table->buffer);
+    free(table);
+}
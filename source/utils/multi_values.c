@@ -7,9 +7,15 @@
  * See LICENSE file in the project root for full license information.
  */
 
+#include "argus/errors.h"
+#include "argus/internal/cross_platform.h"
+#include "argus/internal/parsing.h"
+#include "argus/internal/sort.h"
 #include "argus/internal/utils.h"
 #include "argus/types.h"
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -120,102 +126,330 @@ void sort_int_array(argus_value_t *array, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(array, count, sizeof(argus_value_t), compare_int_values);
+    if (!sort_values(array, count, sizeof(argus_value_t), 0, SORT_KEY_INT))
+        qsort(array, count, sizeof(argus_value_t), compare_int_values);
 }
 
 void sort_string_array(argus_value_t *array, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(array, count, sizeof(argus_value_t), compare_string_values);
+    if (!sort_values(array, count, sizeof(argus_value_t), 0, SORT_KEY_STRING))
+        qsort(array, count, sizeof(argus_value_t), compare_string_values);
 }
 
 void sort_float_array(argus_value_t *array, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(array, count, sizeof(argus_value_t), compare_float_values);
+    if (!sort_values(array, count, sizeof(argus_value_t), 0, SORT_KEY_FLOAT))
+        qsort(array, count, sizeof(argus_value_t), compare_float_values);
 }
 
 /*
- * Array uniqueness implementations
+ * Uniqueness
+ *
+ * Kept values are compacted at the front of the collection, in their first
+ * occurrence order, and indexed in an open-addressing table so each value is
+ * checked against the kept ones in O(1) on average. If the table cannot be
+ * allocated, the kept values are scanned instead.
+ *
+ * Floats are duplicates when closer than UNIQUE_FLOAT_EPSILON. They are hashed
+ * on a grid of that width, so a value only has to look at the few cells around
+ * its own. Past FLOAT_GRID_LIMIT the grid would lose precision, but doubles
+ * are then at least EPSILON / 2 apart, so neighbouring bit patterns are used.
  */
 
-size_t make_int_array_unique(argus_value_t *array, size_t count)
+#define UNIQUE_FLOAT_EPSILON 0.0000001
+#define UNIQUE_FLOAT_SCALE   10000000.0
+#define FLOAT_GRID_LIMIT     4503599627370496.0 /* 2^52, grid cells stay exact below */
+#define FLOAT_GRID_MARGIN    16.0               /* Cells probed in both spaces near the limit */
+#define UNIQUE_MAX_KEYS      8
+
+typedef enum unique_kind_e
 {
-    if (count <= 1)
-        return count;
+    UNIQUE_NONE = 0,
+    UNIQUE_INT,
+    UNIQUE_STRING,
+    UNIQUE_FLOAT,
+    UNIQUE_BOOL,
+} unique_kind_t;
+
+typedef struct unique_set_s
+{
+    char         *base;   /* First element of the collection */
+    size_t        stride; /* Size of an element */
+    size_t        offset; /* Offset of the compared value in an element */
+    unique_kind_t kind;
+    uint32_t     *slots;  /* Kept position + 1 (0 = empty), NULL to scan */
+    size_t        mask;
+    size_t        kept;   /* Number of values kept so far */
+} unique_set_t;
+
+static unique_kind_t unique_kind(argus_valtype_t type)
+{
+    switch (type) {
+        case VALUE_TYPE_INT:
+        case VALUE_TYPE_ARRAY_INT:
+        case VALUE_TYPE_VARIADIC_INT:
+        case VALUE_TYPE_MAP_INT:
+            return (UNIQUE_INT);
+        case VALUE_TYPE_STRING:
+        case VALUE_TYPE_ARRAY_STRING:
+        case VALUE_TYPE_VARIADIC_STRING:
+        case VALUE_TYPE_MAP_STRING:
+            return (UNIQUE_STRING);
+        case VALUE_TYPE_FLOAT:
+        case VALUE_TYPE_ARRAY_FLOAT:
+        case VALUE_TYPE_VARIADIC_FLOAT:
+        case VALUE_TYPE_MAP_FLOAT:
+            return (UNIQUE_FLOAT);
+        case VALUE_TYPE_BOOL:
+        case VALUE_TYPE_MAP_BOOL:
+            return (UNIQUE_BOOL);
+        default:
+            return (UNIQUE_NONE);
+    }
+}
 
-    size_t unique_count = 1;
+static bool unique_equal(unique_kind_t kind, argus_value_t a, argus_value_t b)
+{
+    switch (kind) {
+        case UNIQUE_INT:
+            return (a.as_int == b.as_int);
+        case UNIQUE_STRING:
+            return (a.as_string && b.as_string && strcmp(a.as_string, b.as_string) == 0);
+        case UNIQUE_FLOAT:
+            return (fabs(a.as_float - b.as_float) < UNIQUE_FLOAT_EPSILON);
+        case UNIQUE_BOOL:
+            return (a.as_bool == b.as_bool);
+        default:
+            return (false);
+    }
+}
 
-    for (size_t i = 1; i < count; i++) {
-        bool is_duplicate = false;
+static uint64_t mix_key(uint64_t key)
+{
+    // splitmix64 finalizer
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return (key);
+}
 
-        for (size_t j = 0; j < unique_count; j++) {
-            if (array[i].as_int == array[j].as_int) {
-                is_duplicate = true;
-                break;
-            }
-        }
+// Bit pattern ordered like the doubles, so neighbouring doubles get neighbouring keys
+static uint64_t float_bits_key(double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return ((bits >> 63) ? ~bits : bits | (1ULL << 63));
+}
 
-        if (!is_duplicate)
-            array[unique_count++] = array[i];
+/**
+ * float_keys - Keys of a float, either the one it is stored under or all those to probe
+ */
+static size_t float_keys(double value, uint64_t *keys, bool probe)
+{
+    double cell    = value * UNIQUE_FLOAT_SCALE;
+    bool   in_grid = fabs(cell) < FLOAT_GRID_LIMIT;
+    bool   margin  = fabs(fabs(cell) - FLOAT_GRID_LIMIT) < FLOAT_GRID_MARGIN;
+    size_t count   = 0;
+
+    if (!probe) {
+        keys[0] = in_grid ? (uint64_t)(int64_t)floor(cell) : float_bits_key(value);
+        return (1);
     }
 
-    return unique_count;
+    // Values within EPSILON land at most two grid cells or one bit pattern away
+    if (in_grid || margin) {
+        int64_t center = (int64_t)floor(cell);
+        for (int64_t delta = -2; delta <= 2; ++delta)
+            keys[count++] = (uint64_t)(center + delta);
+    }
+    if (!in_grid || margin) {
+        uint64_t center = float_bits_key(value);
+        keys[count++]   = center - 1;
+        keys[count++]   = center;
+        keys[count++]   = center + 1;
+    }
+    return (count);
 }
 
-size_t make_string_array_unique(argus_value_t *array, size_t count)
+static size_t unique_keys(unique_kind_t kind, argus_value_t value, uint64_t *keys, bool probe)
 {
-    if (count <= 1)
-        return count;
+    switch (kind) {
+        case UNIQUE_INT:
+            keys[0] = (uint64_t)(int64_t)value.as_int;
+            return (1);
+        case UNIQUE_STRING:
+            // NULL strings are never duplicates
+            if (value.as_string == NULL)
+                return (0);
+            keys[0] = hash_string(value.as_string, strlen(value.as_string));
+            return (1);
+        case UNIQUE_FLOAT:
+            return (float_keys(value.as_float, keys, probe));
+        case UNIQUE_BOOL:
+            keys[0] = value.as_bool;
+            return (1);
+        default:
+            return (0);
+    }
+}
+
+static argus_value_t unique_value(const unique_set_t *set, size_t position)
+{
+    argus_value_t value;
 
-    size_t unique_count = 1;
+    memcpy(&value, set->base + position * set->stride + set->offset, sizeof(value));
+    return (value);
+}
 
-    for (size_t i = 1; i < count; i++) {
-        bool is_duplicate = false;
+static void unique_init(unique_set_t *set, void *base, size_t stride, size_t offset,
+                        size_t count, argus_valtype_t type)
+{
+    *set = (unique_set_t){
+        .base   = base,
+        .stride = stride,
+        .offset = offset,
+        .kind   = unique_kind(type),
+    };
+    if (count >= UINT32_MAX)
+        return;
 
-        for (size_t j = 0; j < unique_count; j++) {
-            if (array[i].as_string && array[j].as_string &&
-                strcmp(array[i].as_string, array[j].as_string) == 0) {
-                is_duplicate = true;
-                // Free duplicate string
-                free(array[i].as_string);
-                break;
-            }
+    size_t size = hash_table_size(count);
+    set->slots  = calloc(size, sizeof(uint32_t));
+    set->mask   = size - 1;
+}
+
+static bool unique_contains(const unique_set_t *set, argus_value_t value)
+{
+    uint64_t keys[UNIQUE_MAX_KEYS];
+
+    if (set->slots == NULL) {
+        for (size_t i = 0; i < set->kept; ++i) {
+            if (unique_equal(set->kind, unique_value(set, i), value))
+                return (true);
         }
+        return (false);
+    }
 
-        if (!is_duplicate)
-            array[unique_count++] = array[i];
+    size_t key_count = unique_keys(set->kind, value, keys, true);
+    for (size_t k = 0; k < key_count; ++k) {
+        size_t slot = mix_key(keys[k]) & set->mask;
+        while (set->slots[slot] != 0) {
+            if (unique_equal(set->kind, unique_value(set, set->slots[slot] - 1), value))
+                return (true);
+            slot = (slot + 1) & set->mask;
+        }
     }
+    return (false);
+}
 
-    return unique_count;
+static void unique_keep(unique_set_t *set, size_t position)
+{
+    uint64_t key;
+
+    if (position != set->kept)
+        memcpy(set->base + set->kept * set->stride, set->base + position * set->stride,
+               set->stride);
+    if (set->slots != NULL && unique_keys(set->kind, unique_value(set, set->kept), &key, false)) {
+        size_t slot = mix_key(key) & set->mask;
+        while (set->slots[slot] != 0)
+            slot = (slot + 1) & set->mask;
+        set->slots[slot] = (uint32_t)(set->kept + 1);
+    }
+    set->kept++;
 }
 
-size_t make_float_array_unique(argus_value_t *array, size_t count)
+/**
+ * unique_compact - Keep the first occurrence of each value of a collection
+ *
+ * @param base    First element
+ * @param stride  Size of an element
+ * @param offset  Offset of the compared value in an element
+ * @param count   Number of elements
+ * @param type    Type of the values
+ * @param drop    Called on each dropped element (may be NULL)
+ *
+ * @return Number of elements kept
+ */
+static size_t unique_compact(void *base, size_t stride, size_t offset, size_t count,
+                             argus_valtype_t type, void (*drop)(void *))
 {
-    if (count <= 1)
-        return count;
+    unique_set_t set;
 
-    size_t unique_count = 1;
+    if (count <= 1)
+        return (count);
+
+    unique_init(&set, base, stride, offset, count, type);
+    for (size_t i = 0; i < count; ++i) {
+        if (!unique_contains(&set, unique_value(&set, i)))
+            unique_keep(&set, i);
+        else if (drop != NULL)
+            drop(set.base + i * stride);
+    }
+    free(set.slots);
+    return (set.kept);
+}
 
-    for (size_t i = 1; i < count; i++) {
-        bool is_duplicate = false;
+// Sorted values only have to be compared with the last one kept
+static size_t unique_compact_sorted(argus_value_t *array, size_t count, argus_valtype_t type,
+                                    void (*drop)(void *))
+{
+    unique_kind_t kind = unique_kind(type);
+    size_t        kept = 1;
 
-        for (size_t j = 0; j < unique_count; j++) {
-            // Use small epsilon for float comparison
-            if (fabs(array[i].as_float - array[j].as_float) < 0.0000001) {
-                is_duplicate = true;
-                break;
-            }
-        }
+    if (count <= 1)
+        return (count);
 
-        if (!is_duplicate) {
-            array[unique_count++] = array[i];
-        }
+    for (size_t i = 1; i < count; ++i) {
+        if (!unique_equal(kind, array[kept - 1], array[i]))
+            array[kept++] = array[i];
+        else if (drop != NULL)
+            drop(&array[i]);
     }
+    return (kept);
+}
+
+static void drop_string_value(void *element)
+{
+    free(((argus_value_t *)element)->as_string);
+}
+
+static void drop_pair(void *element)
+{
+    free((void *)((argus_pair_t *)element)->key);
+}
 
-    return unique_count;
+static void drop_string_pair(void *element)
+{
+    free((void *)((argus_pair_t *)element)->key);
+    free(((argus_pair_t *)element)->value.as_string);
+}
+
+/*
+ * Array uniqueness implementations
+ */
+
+size_t make_int_array_unique(argus_value_t *array, size_t count)
+{
+    return (unique_compact(array, sizeof(argus_value_t), 0, count, VALUE_TYPE_INT, NULL));
+}
+
+size_t make_string_array_unique(argus_value_t *array, size_t count, bool owned)
+{
+    // Arena and borrowed strings are not freed one by one
+    return (unique_compact(array, sizeof(argus_value_t), 0, count, VALUE_TYPE_STRING,
+                           owned ? drop_string_value : NULL));
+}
+
+size_t make_float_array_unique(argus_value_t *array, size_t count)
+{
+    return (unique_compact(array, sizeof(argus_value_t), 0, count, VALUE_TYPE_FLOAT, NULL));
 }
 
 /*
@@ -226,123 +460,143 @@ void sort_map_by_keys(argus_pair_t *map, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(map, count, sizeof(argus_pair_t), compare_map_keys);
+    if (!sort_values(map, count, sizeof(argus_pair_t), offsetof(argus_pair_t, key),
+                     SORT_KEY_STRING))
+        qsort(map, count, sizeof(argus_pair_t), compare_map_keys);
 }
 
 void sort_map_by_int_values(argus_pair_t *map, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(map, count, sizeof(argus_pair_t), compare_map_int_values);
+    if (!sort_values(map, count, sizeof(argus_pair_t), offsetof(argus_pair_t, value),
+                     SORT_KEY_INT))
+        qsort(map, count, sizeof(argus_pair_t), compare_map_int_values);
 }
 
 void sort_map_by_string_values(argus_pair_t *map, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(map, count, sizeof(argus_pair_t), compare_map_string_values);
+    if (!sort_values(map, count, sizeof(argus_pair_t), offsetof(argus_pair_t, value),
+                     SORT_KEY_STRING))
+        qsort(map, count, sizeof(argus_pair_t), compare_map_string_values);
 }
 
 void sort_map_by_float_values(argus_pair_t *map, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(map, count, sizeof(argus_pair_t), compare_map_float_values);
+    if (!sort_values(map, count, sizeof(argus_pair_t), offsetof(argus_pair_t, value),
+                     SORT_KEY_FLOAT))
+        qsort(map, count, sizeof(argus_pair_t), compare_map_float_values);
 }
 
 void sort_map_by_bool_values(argus_pair_t *map, size_t count)
 {
     if (count <= 1)
         return;
-    qsort(map, count, sizeof(argus_pair_t), compare_map_bool_values);
+    if (!sort_values(map, count, sizeof(argus_pair_t), offsetof(argus_pair_t, value),
+                     SORT_KEY_BOOL))
+        qsort(map, count, sizeof(argus_pair_t), compare_map_bool_values);
 }
 
 /*
  * Map uniqueness implementation
  */
 
-size_t make_map_values_unique(argus_pair_t *map, size_t count, argus_valtype_t type)
+size_t make_map_values_unique(argus_pair_t *map, size_t count, argus_valtype_t type,
+                              bool owned)
 {
-    if (count <= 1)
-        return count;
-
-    // Allocate array to track duplicates
-    bool *duplicates = calloc(count, sizeof(bool));
-    if (!duplicates)
-        return count;  // Failed to allocate, return unchanged
-
-    size_t unique_count = 0;
-
-    // Mark duplicates
-    for (size_t i = 0; i < count; i++) {
-        if (duplicates[i])
-            continue;
-
-        for (size_t j = i + 1; j < count; j++) {
-            if (duplicates[j])
-                continue;
-
-            bool is_duplicate = false;
-
-            switch (type) {
-                case VALUE_TYPE_INT:
-                case VALUE_TYPE_MAP_INT:
-                    is_duplicate = (map[i].value.as_int == map[j].value.as_int);
-                    break;
-
-                case VALUE_TYPE_STRING:
-                case VALUE_TYPE_MAP_STRING:
-                    if (map[i].value.as_string && map[j].value.as_string) {
-                        is_duplicate =
-                            (strcmp(map[i].value.as_string, map[j].value.as_string) == 0);
-                    }
-                    break;
-
-                case VALUE_TYPE_FLOAT:
-                case VALUE_TYPE_MAP_FLOAT:
-                    is_duplicate =
-                        (fabs(map[i].value.as_float - map[j].value.as_float) < 0.0000001);
-                    break;
-
-                case VALUE_TYPE_BOOL:
-                case VALUE_TYPE_MAP_BOOL:
-                    is_duplicate = (map[i].value.as_bool == map[j].value.as_bool);
-                    break;
-
-                default:
-                    break;
-            }
-
-            if (is_duplicate)
-                duplicates[j] = true;
-        }
-    }
+    void (*drop)(void *) = NULL;
+
+    // Arena and borrowed strings are not freed one by one
+    if (owned)
+        drop = unique_kind(type) == UNIQUE_STRING ? drop_string_pair : drop_pair;
+    return (unique_compact(map, sizeof(argus_pair_t), offsetof(argus_pair_t, value), count, type,
+                           drop));
+}
+
+/*
+ * Map key index
+ *
+ * Map options keep an open-addressing table of their keys next to the pairs,
+ * which stay in insertion order for iteration. The table has twice as many
+ * slots as the map has capacity, so the load factor never exceeds 1/2.
+ */
+
+static size_t map_slot_count(const argus_option_t *option)
+{
+    // Capacities start at MULTI_VALUE_INITIAL_CAPACITY and double: always a power of two
+    return (option->value_capacity * 2);
+}
+
+static void map_index_clear(argus_option_t *option)
+{
+    if (option->map_slots != NULL)
+        memset(option->map_slots, 0, map_slot_count(option) * sizeof(uint32_t));
+}
+
+static void map_index_refill(argus_option_t *option)
+{
+    map_index_clear(option);
+    for (size_t i = 0; i < option->value_count; ++i)
+        map_index_add(option, i);
+}
+
+// Size the table for the current capacity, a failure falls back to linear lookups
+static void map_index_resize(argus_t *argus, argus_option_t *option)
+{
+    parse_release(argus, option->map_slots);
+    option->map_slots = parse_alloc(argus, map_slot_count(option) * sizeof(uint32_t));
+    map_index_refill(option);
+}
 
-    // Rebuild the array without duplicates
-    for (size_t i = 0; i < count; i++) {
-        if (!duplicates[i]) {
-            if (i != unique_count)
-                map[unique_count] = map[i];
-            unique_count++;
-        } else {
-            // Free duplicate string keys
-            free((void *)map[i].key);
-
-            // Free string values if applicable
-            if ((type == VALUE_TYPE_STRING || type == VALUE_TYPE_MAP_STRING) &&
-                map[i].value.as_string)
-                free(map[i].value.as_string);
+void map_index_add(argus_option_t *option, size_t position)
+{
+    const char *key = option->value.as_map[position].key;
+
+    if (option->map_slots == NULL || key == NULL)
+        return;
+
+    size_t mask = map_slot_count(option) - 1;
+    size_t slot = hash_string(key, strlen(key)) & mask;
+    while (option->map_slots[slot] != 0)
+        slot = (slot + 1) & mask;
+    option->map_slots[slot] = (uint32_t)(position + 1);
+}
+
+int map_find_key(argus_option_t *option, const char *key)
+{
+    if (option->map_slots == NULL) {
+        for (size_t i = 0; i < option->value_count; ++i) {
+            if (option->value.as_map[i].key && strcmp(option->value.as_map[i].key, key) == 0)
+                return ((int)i);
         }
+        return (-1);
     }
 
-    free(duplicates);
-    return unique_count;
+    size_t mask = map_slot_count(option) - 1;
+    size_t slot = hash_string(key, strlen(key)) & mask;
+    while (option->map_slots[slot] != 0) {
+        size_t position = option->map_slots[slot] - 1;
+        if (strcmp(option->value.as_map[position].key, key) == 0)
+            return ((int)position);
+        slot = (slot + 1) & mask;
+    }
+    return (-1);
 }
 
 /*
  * Combined operations for arrays
  */
 
+// Strings to free when dropped: neither in the context arena nor borrowed from argv
+static bool owns_strings(const argus_option_t *option)
+{
+    return (option->is_allocated && !(option->flags & FLAG_BORROW));
+}
+
 void apply_array_flags(argus_option_t *option)
 {
     if (option->value_count <= 1)
@@ -372,7 +626,13 @@ void apply_array_flags(argus_option_t *option)
     }
 
     // Then remove duplicates if needed
-    if (option->flags & FLAG_UNIQUE) {
+    if ((option->flags & FLAG_UNIQUE) && (option->flags & FLAG_SORTED)) {
+        // Duplicates are now next to each other
+        bool owned = owns_strings(option) && unique_kind(option->value_type) == UNIQUE_STRING;
+        option->value_count = unique_compact_sorted(option->value.as_array, option->value_count,
+                                                    option->value_type,
+                                                    owned ? drop_string_value : NULL);
+    } else if (option->flags & FLAG_UNIQUE) {
         size_t new_count = 0;
 
         switch (option->value_type) {
@@ -383,7 +643,8 @@ void apply_array_flags(argus_option_t *option)
 
             case VALUE_TYPE_ARRAY_STRING:
             case VALUE_TYPE_VARIADIC_STRING:
-                new_count = make_string_array_unique(option->value.as_array, option->value_count);
+                new_count = make_string_array_unique(option->value.as_array, option->value_count,
+                                                     owns_strings(option));
                 break;
 
             case VALUE_TYPE_ARRAY_FLOAT:
@@ -413,7 +674,8 @@ void apply_map_flags(argus_option_t *option)
     // Remove entries with duplicate values if needed
     if (option->flags & FLAG_UNIQUE_VALUE) {
         option->value_count =
-            make_map_values_unique(option->value.as_map, option->value_count, option->value_type);
+            make_map_values_unique(option->value.as_map, option->value_count, option->value_type,
+                                   owns_strings(option));
     }
 
     // Sort by key if needed
@@ -442,21 +704,29 @@ void apply_map_flags(argus_option_t *option)
                 break;
         }
     }
+
+    // Positions moved, the key index has to follow them
+    if (option->flags & (FLAG_UNIQUE_VALUE | FLAG_SORTED_KEY | FLAG_SORTED_VALUE))
+        map_index_refill(option);
 }
 
-void adjust_array_size(argus_option_t *option)
+void adjust_array_size(argus_t *argus, argus_option_t *option)
 {
     if (option->value.as_array == NULL) {
         option->value_capacity = MULTI_VALUE_INITIAL_CAPACITY;
-        option->value.as_array = malloc(option->value_capacity * sizeof(argus_value_t));
+        option->value.as_array = parse_alloc(argus, option->value_capacity * sizeof(argus_value_t));
         if (option->value.as_array == NULL) {
             option->value_capacity = 0;
             return;
         }
+        // Values living in the context arena are not released with the option
+        option->is_allocated = argus->arena == NULL;
     } else if (option->value_count >= option->value_capacity) {
         size_t old_capacity = option->value_capacity;
         option->value_capacity *= 2;
-        void *new = realloc(option->value.as_array, option->value_capacity * sizeof(argus_value_t));
+        void *new = parse_realloc(argus, option->value.as_array,
+                                  old_capacity * sizeof(argus_value_t),
+                                  option->value_capacity * sizeof(argus_value_t));
         if (new == NULL) {
             option->value_capacity = old_capacity;
             return;
@@ -465,32 +735,104 @@ void adjust_array_size(argus_option_t *option)
     }
 }
 
-void adjust_map_size(argus_option_t *option)
+// Values of a SINK option go to its callback and are never stored
+int sink_value(argus_t *argus, argus_option_t *option, argus_value_t value)
+{
+    int status = option->sink(argus, value, option->sink_data);
+    if (status != ARGUS_SUCCESS) {
+        ARGUS_PARSING_ERROR(argus, status, "Value rejected for '%s'", option->name);
+        return (status);
+    }
+    option->sink_count++;
+    return (ARGUS_SUCCESS);
+}
+
+void adjust_map_size(argus_t *argus, argus_option_t *option)
 {
     if (option->value.as_map == NULL) {
         option->value_capacity = MULTI_VALUE_INITIAL_CAPACITY;
-        option->value.as_map   = malloc(option->value_capacity * sizeof(argus_pair_t));
+        option->value.as_map   = parse_alloc(argus, option->value_capacity * sizeof(argus_pair_t));
         if (option->value.as_map == NULL) {
             option->value_capacity = 0;
             return;
         }
+        option->is_allocated = argus->arena == NULL;
+        map_index_resize(argus, option);
     } else if (option->value_count >= option->value_capacity) {
         size_t old_capacity = option->value_capacity;
         option->value_capacity *= 2;
-        void *new = realloc(option->value.as_map, option->value_capacity * sizeof(argus_pair_t));
+        void *new = parse_realloc(argus, option->value.as_map, old_capacity * sizeof(argus_pair_t),
+                                  option->value_capacity * sizeof(argus_pair_t));
         if (new == NULL) {
             option->value_capacity = old_capacity;
             return;
         }
         option->value.as_map = new;
+        map_index_resize(argus, option);
     }
 }
 
-int map_find_key(argus_option_t *option, const char *key)
+void clear_multi_values(argus_option_t *option)
 {
-    for (size_t i = 0; i < option->value_count; ++i) {
-        if (option->value.as_map[i].key && strcmp(option->value.as_map[i].key, key) == 0)
-            return ((int)i);
+    if (option->flags & FLAG_BORROW) {
+        // Nothing to release, the strings point into argv
+    } else if (option->value_type & (VALUE_TYPE_ARRAY_STRING | VALUE_TYPE_VARIADIC_STRING)) {
+        for (size_t i = 0; i < option->value_count; ++i)
+            free(option->value.as_array[i].as_string);
+    } else if (option->value_type & VALUE_TYPE_MAP) {
+        for (size_t i = 0; i < option->value_count; ++i) {
+            free((void *)option->value.as_map[i].key);
+            if (option->value_type == VALUE_TYPE_MAP_STRING)
+                free(option->value.as_map[i].value.as_string);
+        }
     }
-    return (-1);
+    // The buffer and its capacity are kept for the next parse
+    option->value_count = 0;
+    map_index_clear(option);
+}
+
+// A read-only argument is cut on a copy, a sink is done with it once it returns
+static char *writable_value(argus_t *argus, argus_option_t *option, char *value, char **scratch)
+{
+    if (option->sink != NULL)
+        return (*scratch = safe_strdup(value));
+    return (borrow_copy(argus, value));
+}
+
+int split_values(argus_t *argus, argus_option_t *option, char *value, value_setter_t setter)
+{
+    bool  borrow  = option->flags & FLAG_BORROW;
+    bool  list    = strchr(value, ',') != NULL;
+    char *scratch = NULL;
+    int   status  = ARGUS_SUCCESS;
+
+    // Borrowing options cut lists at ',' and map pairs at '=', in place
+    if (borrow && argus->const_args && (list || (option->value_type & VALUE_TYPE_MAP))) {
+        value = writable_value(argus, option, value, &scratch);
+        if (value == NULL) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to allocate memory");
+            return (ARGUS_ERROR_MEMORY);
+        }
+    }
+
+    if (!list)
+        status = setter(argus, option, value);
+    else if (borrow) {
+        // Cut the token in place so the values can point into it
+        char *cursor = value;
+        char *word;
+        while (status == ARGUS_SUCCESS && (word = split_next(&cursor, ",")) != NULL)
+            status = setter(argus, option, word);
+    } else {
+        char **words = parse_split(argus, value, ",");
+        if (words == NULL) {
+            ARGUS_PARSING_ERROR(argus, ARGUS_ERROR_MEMORY, "Failed to split string '%s'", value);
+            return (ARGUS_ERROR_MEMORY);
+        }
+        for (size_t i = 0; status == ARGUS_SUCCESS && words[i] != NULL; ++i)
+            status = setter(argus, option, words[i]);
+        parse_free_split(argus, words);
+    }
+    free(scratch);
+    return (status);
 }
@@ -0,0 +1,354 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/option_index.h"
+#include "argus/internal/schema.h"
+#include "argus/internal/utils.h"
+#include "argus/types.h"
+
+static bool lname_equals(const argus_option_t *option, const char *lname, size_t len)
+{
+    return (strncmp(option->lname, lname, len) == 0 && option->lname[len] == '\0');
+}
+
+static int build_lname_table(argus_index_t *index)
+{
+    size_t lname_count = 0;
+
+    for (size_t i = 0; i < index->count; ++i) {
+        if (index->options[i].type == TYPE_OPTION && index->options[i].lname)
+            lname_count++;
+    }
+
+    size_t size        = hash_table_size(lname_count);
+    index->lname_slots = calloc(size, sizeof(uint32_t));
+    if (index->lname_slots == NULL)
+        return (-1);
+    index->lname_mask = size - 1;
+
+    for (size_t i = 0; i < index->count; ++i) {
+        argus_option_t *option = &index->options[i];
+        if (option->type != TYPE_OPTION || option->lname == NULL)
+            continue;
+
+        size_t len  = strlen(option->lname);
+        size_t slot = hash_string(option->lname, len) & index->lname_mask;
+        while (index->lname_slots[slot] != 0) {
+            // Keep the first declaration, like the linear lookup does
+            if (lname_equals(&index->options[index->lname_slots[slot] - 1], option->lname, len))
+                break;
+            slot = (slot + 1) & index->lname_mask;
+        }
+        if (index->lname_slots[slot] == 0)
+            index->lname_slots[slot] = (uint32_t)(i + 1);
+    }
+    return (0);
+}
+
+static void build_sname_table(argus_index_t *index)
+{
+    for (size_t i = 0; i < index->count; ++i) {
+        argus_option_t *option = &index->options[i];
+        unsigned char   sname  = (unsigned char)option->sname;
+
+        if (option->type == TYPE_OPTION && sname != '\0' && index->sname_slots[sname] == 0)
+            index->sname_slots[sname] = (uint32_t)(i + 1);
+    }
+}
+
+static int build_positional_table(argus_index_t *index)
+{
+    size_t fixed_count = 0;
+
+    for (size_t i = 0; i < index->count; ++i) {
+        if (index->options[i].type == TYPE_POSITIONAL)
+            fixed_count++;
+    }
+    if (fixed_count == 0)
+        return (0);
+
+    index->positional_slots = malloc(fixed_count * sizeof(uint32_t));
+    if (index->positional_slots == NULL)
+        return (-1);
+
+    // Positions past the variadic positional can never reach a fixed one
+    for (size_t i = 0; i < index->count; ++i) {
+        if (index->options[i].type != TYPE_POSITIONAL)
+            continue;
+        if (index->options[i].value_type & VALUE_TYPE_VARIADIC) {
+            index->variadic_slot = (uint32_t)(i + 1);
+            break;
+        }
+        index->positional_slots[index->positional_count++] = (uint32_t)(i + 1);
+    }
+    return (0);
+}
+
+static int build_choice_tables(argus_index_t *index)
+{
+    for (size_t i = 0; i < index->count; ++i) {
+        const choices_data_t *choices = enum_choices(&index->options[i]);
+        if (choices == NULL || choices->type != VALUE_TYPE_STRING)
+            continue;
+
+        if (index->choice_tables == NULL) {
+            index->choice_tables = calloc(index->count, sizeof(choice_table_t *));
+            if (index->choice_tables == NULL)
+                return (-1);
+        }
+        index->choice_tables[i] = choice_table_build(choices);
+        if (index->choice_tables[i] == NULL)
+            return (-1);
+    }
+    return (0);
+}
+
+static uint64_t *alloc_mask(uint64_t ***masks, const argus_index_t *index, size_t position)
+{
+    if (*masks == NULL) {
+        *masks = calloc(index->count, sizeof(uint64_t *));
+        if (*masks == NULL)
+            return (NULL);
+    }
+    (*masks)[position] = calloc(index->dependency_words, sizeof(uint64_t));
+    return ((*masks)[position]);
+}
+
+// Resolve a REQUIRE or CONFLICT list, names that match no option are ignored like before
+static int build_name_mask(argus_index_t *index, uint64_t ***masks, size_t position,
+                           const char **names)
+{
+    if (names == NULL)
+        return (0);
+
+    uint64_t *mask = alloc_mask(masks, index, position);
+    if (mask == NULL)
+        return (-1);
+    for (size_t j = 0; names[j] != NULL; ++j) {
+        argus_option_t *target = find_option_by_name(index->options, names[j]);
+        if (target != NULL) {
+            size_t bit = (size_t)(target - index->options);
+            mask[bit / 64] |= (uint64_t)1 << (bit % 64);
+        }
+    }
+    return (0);
+}
+
+static int build_group_mask(argus_index_t *index, size_t position)
+{
+    uint64_t *mask = alloc_mask(&index->group_masks, index, position);
+    if (mask == NULL)
+        return (-1);
+    if (index->group_slots == NULL) {
+        index->group_slots = calloc(index->count, sizeof(uint32_t));
+        if (index->group_slots == NULL)
+            return (-1);
+    }
+
+    // Members run up to the next group header
+    for (size_t bit = position + 1; bit < index->count; ++bit) {
+        if (index->options[bit].type == TYPE_GROUP)
+            break;
+        mask[bit / 64] |= (uint64_t)1 << (bit % 64);
+        index->group_slots[bit] = (uint32_t)(position + 1);
+    }
+    return (0);
+}
+
+static int build_dependency_masks(argus_index_t *index)
+{
+    index->dependency_words = (index->count + 63) / 64;
+    index->visit_mask       = calloc(index->dependency_words ? index->dependency_words : 1,
+                                     sizeof(uint64_t));
+    if (index->visit_mask == NULL)
+        return (-1);
+
+    for (size_t i = 0; i < index->count; ++i) {
+        argus_option_t *option = &index->options[i];
+
+        if (option->type == TYPE_GROUP) {
+            if ((option->flags & FLAG_EXCLUSIVE) && build_group_mask(index, i) != 0)
+                return (-1);
+            continue;
+        }
+        if (option->have_default ||
+            (option->type == TYPE_POSITIONAL && (option->flags & FLAG_REQUIRED)))
+            index->visit_mask[i / 64] |= (uint64_t)1 << (i % 64);
+        if (build_name_mask(index, &index->require_masks, i, option->require) != 0 ||
+            build_name_mask(index, &index->conflict_masks, i, option->conflict) != 0)
+            return (-1);
+    }
+    return (0);
+}
+
+static void free_masks(uint64_t **masks, size_t count)
+{
+    if (masks == NULL)
+        return;
+    for (size_t i = 0; i < count; ++i)
+        free(masks[i]);
+    free(masks);
+}
+
+argus_index_t *index_build(argus_option_t *options)
+{
+    argus_index_t *index = calloc(1, sizeof(argus_index_t));
+    if (index == NULL)
+        return (NULL);
+
+    index->options = options;
+    while (options[index->count].type != TYPE_NONE)
+        index->count++;
+
+    if (build_lname_table(index) != 0 || build_positional_table(index) != 0 ||
+        build_choice_tables(index) != 0 || build_dependency_masks(index) != 0) {
+        index_free(index);
+        return (NULL);
+    }
+    build_sname_table(index);
+    return (index);
+}
+
+void index_free(argus_index_t *index)
+{
+    if (index == NULL)
+        return;
+    free(index->lname_slots);
+    free(index->positional_slots);
+    subcommand_trie_free(index->subcommands);
+    if (index->choice_tables != NULL) {
+        for (size_t i = 0; i < index->count; ++i)
+            choice_table_free(index->choice_tables[i]);
+        free(index->choice_tables);
+    }
+    free_masks(index->require_masks, index->count);
+    free_masks(index->conflict_masks, index->count);
+    free_masks(index->group_masks, index->count);
+    free(index->visit_mask);
+    free(index->group_slots);
+    free(index);
+}
+
+argus_index_t *index_activate(argus_t *argus, argus_option_t *options)
+{
+    size_t depth = argus->subcommand_depth;
+
+    if (depth > MAX_SUBCOMMAND_DEPTH)
+        return (NULL);
+    if (argus->indexes[depth] != NULL && argus->level_options[depth] == options)
+        return (argus->indexes[depth]);
+
+    argus->level_options[depth] = options;
+    if (argus->schema != NULL) {
+        // Results share the indexes compiled in their schema
+        const schema_level_t *level = schema_find_level(argus->schema, argus->storage, options);
+        argus->indexes[depth]       = level != NULL ? level->index : NULL;
+        return (argus->indexes[depth]);
+    }
+
+    index_free(argus->indexes[depth]);
+    argus->indexes[depth] = index_build(options);
+    return (argus->indexes[depth]);
+}
+
+argus_index_t *index_get(const argus_t *argus, const argus_option_t *options)
+{
+    size_t depth = argus->subcommand_depth;
+
+    if (depth > MAX_SUBCOMMAND_DEPTH || argus->indexes[depth] == NULL)
+        return (NULL);
+    if (argus->level_options[depth] != options)
+        return (NULL);
+    return (argus->indexes[depth]);
+}
+
+void index_release_all(argus_t *argus)
+{
+    for (size_t i = 0; i <= MAX_SUBCOMMAND_DEPTH; ++i) {
+        if (argus->schema == NULL)
+            index_free(argus->indexes[i]);
+        argus->indexes[i]       = NULL;
+        argus->level_options[i] = NULL;
+    }
+}
+
+argus_index_t *index_find_level(const argus_t *argus, const argus_option_t *options)
+{
+    for (size_t depth = 0; depth <= MAX_SUBCOMMAND_DEPTH; ++depth) {
+        if (argus->indexes[depth] != NULL && argus->level_options[depth] == options)
+            return (argus->indexes[depth]);
+    }
+    return (NULL);
+}
+
+argus_option_t *index_rebase(const argus_index_t *index, argus_option_t *options,
+                             const argus_option_t *option)
+{
+    if (option == NULL)
+        return (NULL);
+    return (&options[option - index->options]);
+}
+
+argus_option_t *index_find_lname(const argus_index_t *index, const char *lname, size_t len)
+{
+    size_t slot = hash_string(lname, len) & index->lname_mask;
+
+    while (index->lname_slots[slot] != 0) {
+        argus_option_t *option = &index->options[index->lname_slots[slot] - 1];
+        if (lname_equals(option, lname, len))
+            return (option);
+        slot = (slot + 1) & index->lname_mask;
+    }
+    return (NULL);
+}
+
+argus_option_t *index_find_sname(const argus_index_t *index, char sname)
+{
+    uint32_t slot = index->sname_slots[(unsigned char)sname];
+
+    if (slot == 0)
+        return (NULL);
+    return (&index->options[slot - 1]);
+}
+
+argus_option_t *index_find_positional(const argus_index_t *index, int position)
+{
+    uint32_t slot = index->variadic_slot;
+
+    if (position >= 0 && (size_t)position < index->positional_count)
+        slot = index->positional_slots[position];
+    if (slot == 0)
+        return (NULL);
+    return (&index->options[slot - 1]);
+}
+
+const choice_table_t *index_find_choices(const argus_t *argus, const argus_option_t *option)
+{
+    for (size_t depth = 0; depth <= MAX_SUBCOMMAND_DEPTH; ++depth) {
+        const argus_index_t  *index   = argus->indexes[depth];
+        const argus_option_t *options = argus->level_options[depth];
+
+        if (index == NULL || index->choice_tables == NULL || options == NULL)
+            continue;
+        if (option >= options && option < options + index->count)
+            return (index->choice_tables[option - options]);
+    }
+    return (NULL);
+}
+
+const subcommand_trie_t *index_subcommands(argus_index_t *index)
+{
+    if (index->subcommands == NULL)
+        index->subcommands = subcommand_trie_build(index->options);
+    return (index->subcommands);
+}
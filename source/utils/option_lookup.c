@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "argus/internal/option_index.h"
 #include "argus/internal/utils.h"
 #include "argus/types.h"
 
@@ -25,6 +26,21 @@ argus_option_t *find_option_by_lname(argus_option_t *options, const char *lname)
     return (NULL);
 }
 
+argus_option_t *find_long_option(argus_t *argus, argus_option_t *options, const char *lname,
+                                 size_t len)
+{
+    const argus_index_t *index = index_get(argus, options);
+    if (index != NULL)
+        return (index_rebase(index, options, index_find_lname(index, lname, len)));
+
+    for (int i = 0; options[i].type != TYPE_NONE; ++i) {
+        if (options[i].type == TYPE_OPTION && options[i].lname &&
+            strncmp(options[i].lname, lname, len) == 0 && options[i].lname[len] == '\0')
+            return (&options[i]);
+    }
+    return (NULL);
+}
+
 argus_option_t *find_option_by_sname(argus_option_t *options, char sname)
 {
     for (int i = 0; options[i].type != TYPE_NONE; ++i) {
@@ -34,6 +50,14 @@ argus_option_t *find_option_by_sname(argus_option_t *options, char sname)
     return (NULL);
 }
 
+argus_option_t *find_short_option(argus_t *argus, argus_option_t *options, char sname)
+{
+    const argus_index_t *index = index_get(argus, options);
+    if (index != NULL)
+        return (index_rebase(index, options, index_find_sname(index, sname)));
+    return (find_option_by_sname(options, sname));
+}
+
 argus_option_t *find_positional(argus_option_t *options, int position)
 {
     int pos_index = 0;
@@ -48,6 +72,14 @@ argus_option_t *find_positional(argus_option_t *options, int position)
     return (NULL);
 }
 
+argus_option_t *find_positional_option(argus_t *argus, argus_option_t *options, int position)
+{
+    const argus_index_t *index = index_get(argus, options);
+    if (index != NULL)
+        return (index_rebase(index, options, index_find_positional(index, position)));
+    return (find_positional(options, position));
+}
+
 argus_option_t *find_option_by_name(argus_option_t *options, const char *name)
 {
     for (int i = 0; options[i].type != TYPE_NONE; ++i) {
@@ -68,7 +100,7 @@ const argus_option_t *get_active_options(argus_t *argus)
     return (argus->options);
 }
 
-static argus_option_t *find_from_relative_path(argus_t *argus, const char *option_name)
+static argus_option_t *find_from_relative_path(const argus_t *argus, const char *option_name)
 {
     for (int i = (int)argus->subcommand_depth; i >= 0; --i) {
         argus_option_t *options;
@@ -96,38 +128,38 @@ static size_t count_components(const char *path)
     return (count);
 }
 
-argus_option_t *find_option_by_active_path(argus_t argus, const char *option_path)
+argus_option_t *find_option_by_active_path(const argus_t *argus, const char *option_path)
 {
     if (option_path == NULL)
         return (NULL);
 
     // Format: "option_name"
     if (strchr(option_path, '.') == NULL)
-        return (find_from_relative_path(&argus, option_path));
+        return (find_from_relative_path(argus, option_path));
 
     // Format: ".option_name" (root)
     if (option_path[0] == '.')
-        return (find_option_by_name(argus.options, option_path + 1));
+        return (find_option_by_name(argus->options, option_path + 1));
 
     size_t component_count = count_components(option_path);
-    if (component_count > argus.subcommand_depth)
+    if (component_count > argus->subcommand_depth)
         return (NULL);
 
     // Format: "subcommand.option_name"
     const char     *component = option_path;
-    argus_option_t *options   = argus.options;
+    argus_option_t *options   = argus->options;
     for (size_t i = 0; i < component_count; ++i) {
         char *next_dot = strchr(component, '.');
         if (next_dot == NULL)
             break;
 
-        const char *command          = argus.subcommand_stack[i]->name;
+        const char *command          = argus->subcommand_stack[i]->name;
         size_t      component_lenght = next_dot - component;
         if (strncmp(component, command, component_lenght) != 0)
             return (NULL);
 
         component = next_dot + 1;
-        options   = argus.subcommand_stack[i]->sub_options;
+        options   = argus->subcommand_stack[i]->sub_options;
     }
 
     return (find_option_by_name(options, component));
@@ -0,0 +1,303 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/sort.h"
+#include "argus/types.h"
+
+#define MKQS_INSERTION_THRESHOLD 16
+
+typedef struct radix_record_s
+{
+    uint64_t key;   /* Key bits, ordered like the values */
+    size_t   index; /* Position of the element before sorting */
+} radix_record_t;
+
+typedef struct string_record_s
+{
+    uint64_t             prefix; /* Next bytes of the string at the current depth */
+    const unsigned char *str;
+    size_t               index;
+} string_record_t;
+
+static argus_value_t value_at(const char *base, size_t stride, size_t offset, size_t i)
+{
+    argus_value_t value;
+
+    memcpy(&value, base + i * stride + offset, sizeof(value));
+    return (value);
+}
+
+// Move every element to the position its record ended at
+static bool gather(char *base, size_t count, size_t stride, const void *records,
+                   size_t record_size, size_t index_offset)
+{
+    char *sorted = malloc(count * stride);
+    if (sorted == NULL)
+        return (false);
+
+    for (size_t i = 0; i < count; ++i) {
+        size_t index;
+        memcpy(&index, (const char *)records + i * record_size + index_offset, sizeof(size_t));
+        memcpy(sorted + i * stride, base + index * stride, stride);
+    }
+    memcpy(base, sorted, count * stride);
+    free(sorted);
+    return (true);
+}
+
+/*
+ * LSD radix sort
+ */
+
+static uint64_t radix_key(argus_value_t value, sort_key_t key)
+{
+    uint64_t bits;
+
+    switch (key) {
+        case SORT_KEY_INT:
+            // Flip the sign bit so negative values come first
+            return ((uint32_t)value.as_int ^ 0x80000000u);
+        case SORT_KEY_FLOAT:
+            // Negative doubles order backwards: invert them, set the sign of the others
+            memcpy(&bits, &value.as_float, sizeof(bits));
+            return ((bits >> 63) ? ~bits : bits | (1ULL << 63));
+        default:
+            return (value.as_bool ? 1 : 0);
+    }
+}
+
+static size_t radix_key_bytes(sort_key_t key)
+{
+    switch (key) {
+        case SORT_KEY_INT:
+            return (sizeof(uint32_t));
+        case SORT_KEY_FLOAT:
+            return (sizeof(uint64_t));
+        default:
+            return (1);
+    }
+}
+
+static bool radix_sort(char *base, size_t count, size_t stride, size_t offset, sort_key_t key)
+{
+    size_t          key_bytes = radix_key_bytes(key);
+    radix_record_t *records   = malloc(count * sizeof(radix_record_t));
+    radix_record_t *scratch   = malloc(count * sizeof(radix_record_t));
+    size_t(*histograms)[256]  = calloc(key_bytes, sizeof(*histograms));
+
+    if (records == NULL || scratch == NULL || histograms == NULL) {
+        free(records);
+        free(scratch);
+        free(histograms);
+        return (false);
+    }
+
+    // Count every byte of every key in a single pass
+    for (size_t i = 0; i < count; ++i) {
+        records[i].key   = radix_key(value_at(base, stride, offset, i), key);
+        records[i].index = i;
+        for (size_t b = 0; b < key_bytes; ++b)
+            histograms[b][(records[i].key >> (b * 8)) & 0xff]++;
+    }
+
+    for (size_t b = 0; b < key_bytes; ++b) {
+        size_t *histogram = histograms[b];
+        size_t  shift     = b * 8;
+
+        // Every key shares this byte: the pass would not move anything
+        if (histogram[(records[0].key >> shift) & 0xff] == count)
+            continue;
+
+        size_t position = 0;
+        for (size_t digit = 0; digit < 256; ++digit) {
+            size_t digit_count = histogram[digit];
+            histogram[digit]   = position;
+            position += digit_count;
+        }
+        for (size_t i = 0; i < count; ++i)
+            scratch[histogram[(records[i].key >> shift) & 0xff]++] = records[i];
+
+        radix_record_t *swap = records;
+        records              = scratch;
+        scratch              = swap;
+    }
+
+    bool sorted = gather(base, count, stride, records, sizeof(radix_record_t),
+                         offsetof(radix_record_t, index));
+    free(records);
+    free(scratch);
+    free(histograms);
+    return (sorted);
+}
+
+/*
+ * Multikey quicksort
+ *
+ * Partitions on the next bytes of the strings, and only moves further inside
+ * the partition sharing them: common prefixes are compared once per level
+ * instead of once per comparison. Each record caches the 8 bytes at its
+ * current depth, packed big-endian so integer order is strcmp order, which
+ * keeps partitioning inside the record array instead of chasing pointers.
+ */
+
+#define PREFIX_BYTES sizeof(uint64_t)
+
+static void load_prefix(string_record_t *record, size_t depth)
+{
+    const unsigned char *str    = record->str + depth;
+    uint64_t             prefix = 0;
+    size_t               i      = 0;
+
+    // Bytes past the terminator stay 0, a string never contains one before it
+    for (; i < PREFIX_BYTES && str[i] != '\0'; ++i)
+        prefix = (prefix << 8) | str[i];
+    record->prefix = i == 0 ? 0 : prefix << (8 * (PREFIX_BYTES - i));
+}
+
+// A prefix whose last byte is 0 holds the end of its string
+static bool prefix_ends(uint64_t prefix)
+{
+    return ((prefix & 0xff) == 0);
+}
+
+static void swap_records(string_record_t *a, string_record_t *b)
+{
+    string_record_t tmp = *a;
+    *a                  = *b;
+    *b                  = tmp;
+}
+
+static int compare_records(const string_record_t *a, const string_record_t *b, size_t depth)
+{
+    if (a->prefix != b->prefix)
+        return (a->prefix < b->prefix ? -1 : 1);
+    if (prefix_ends(a->prefix))
+        return (0);
+    return (strcmp((const char *)a->str + depth + PREFIX_BYTES,
+                   (const char *)b->str + depth + PREFIX_BYTES));
+}
+
+static void insertion_sort(string_record_t *records, size_t count, size_t depth)
+{
+    for (size_t i = 1; i < count; ++i) {
+        string_record_t current = records[i];
+        size_t          j       = i;
+
+        while (j > 0 && compare_records(&records[j - 1], &current, depth) > 0) {
+            records[j] = records[j - 1];
+            j--;
+        }
+        records[j] = current;
+    }
+}
+
+static uint64_t median_prefix(const string_record_t *records, size_t count)
+{
+    uint64_t a = records[0].prefix;
+    uint64_t b = records[count / 2].prefix;
+    uint64_t c = records[count - 1].prefix;
+
+    if ((a <= b && b <= c) || (c <= b && b <= a))
+        return (b);
+    if ((b <= a && a <= c) || (c <= a && a <= b))
+        return (a);
+    return (c);
+}
+
+static void multikey_quicksort(string_record_t *records, size_t count, size_t depth)
+{
+    while (count > MKQS_INSERTION_THRESHOLD) {
+        uint64_t pivot = median_prefix(records, count);
+        size_t   lt    = 0;
+        size_t   i     = 0;
+        size_t   gt    = count;
+
+        // Three-way partition on the cached prefix
+        while (i < gt) {
+            uint64_t prefix = records[i].prefix;
+            if (prefix < pivot)
+                swap_records(&records[lt++], &records[i++]);
+            else if (prefix > pivot)
+                swap_records(&records[i], &records[--gt]);
+            else
+                i++;
+        }
+
+        struct
+        {
+            string_record_t *records;
+            size_t           count;
+            size_t           depth;
+        } parts[3] = {
+            {records, lt, depth},
+            // Strings equal up to their terminator need no further sorting
+            {records + lt, prefix_ends(pivot) ? 0 : gt - lt, depth + PREFIX_BYTES},
+            {records + gt, count - gt, depth},
+        };
+        for (size_t k = 0; k < parts[1].count; ++k)
+            load_prefix(&parts[1].records[k], parts[1].depth);
+
+        // Recurse on the two smaller parts, loop on the largest to bound the stack
+        size_t largest = 0;
+        for (size_t p = 1; p < 3; ++p) {
+            if (parts[p].count > parts[largest].count)
+                largest = p;
+        }
+        for (size_t p = 0; p < 3; ++p) {
+            if (p != largest)
+                multikey_quicksort(parts[p].records, parts[p].count, parts[p].depth);
+        }
+        records = parts[largest].records;
+        count   = parts[largest].count;
+        depth   = parts[largest].depth;
+    }
+    insertion_sort(records, count, depth);
+}
+
+static bool string_sort(char *base, size_t count, size_t stride, size_t offset)
+{
+    string_record_t *records = malloc(count * sizeof(string_record_t));
+    size_t           nulls   = 0;
+
+    if (records == NULL)
+        return (false);
+
+    // NULL strings come first, in their original order
+    for (size_t i = 0; i < count; ++i) {
+        if (value_at(base, stride, offset, i).as_string == NULL)
+            records[nulls++] = (string_record_t){.str = NULL, .index = i};
+    }
+    for (size_t i = 0, next = nulls; i < count; ++i) {
+        const char *str = value_at(base, stride, offset, i).as_string;
+        if (str == NULL)
+            continue;
+        records[next] = (string_record_t){.str = (const unsigned char *)str, .index = i};
+        load_prefix(&records[next++], 0);
+    }
+
+    multikey_quicksort(records + nulls, count - nulls, 0);
+    bool sorted = gather(base, count, stride, records, sizeof(string_record_t),
+                         offsetof(string_record_t, index));
+    free(records);
+    return (sorted);
+}
+
+bool sort_values(void *base, size_t count, size_t stride, size_t offset, sort_key_t key)
+{
+    if (count < SORT_KERNEL_THRESHOLD)
+        return (false);
+    if (key == SORT_KEY_STRING)
+        return (string_sort(base, count, stride, offset));
+    return (radix_sort(base, count, stride, offset, key));
+}
@@ -9,9 +9,13 @@
 
 #define _GNU_SOURCE  // NOLINT
 
+#include "argus/internal/arena.h"
 #include "argus/internal/cross_platform.h"
+#include "argus/internal/utils.h"
+#include <ctype.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -35,6 +39,37 @@ char *starts_with(const char *prefix, const char *str)
     return (NULL);
 }
 
+/**
+ * Computes the FNV-1a hash of a string.
+ * @param str The string to hash.
+ * @param len The number of bytes to hash.
+ * @return The 32-bit hash of the first len bytes of str.
+ */
+uint32_t hash_string(const char *str, size_t len)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= (unsigned char)str[i];
+        hash *= 16777619u;
+    }
+    return (hash);
+}
+
+/**
+ * Computes the slot count of an open-addressing table.
+ * @param count The number of entries the table will hold.
+ * @return A power of two keeping the load factor at or below 1/2.
+ */
+size_t hash_table_size(size_t count)
+{
+    size_t size = 8;
+
+    while (size < count * 2)
+        size <<= 1;
+    return (size);
+}
+
 static size_t count_words(const char *str, const char *charset)
 {
     size_t count = 0;
@@ -76,17 +111,12 @@ static void cleanup_split(char **split, size_t nb_words)
     free(split);
 }
 
-/**
- * Splits a string into an array of strings using a charset.
- * @param str The string to split.
- * @param charset The charset used to split the string.
- * @return An array of strings or NULL if an error occurred.
- */
-char **split(const char *str, const char *charset)
+static char **split_words(argus_arena_t *arena, const char *str, const char *charset)
 {
     char  *tmp      = (char *)str;
     size_t nb_words = count_words(str, charset);
-    char **result   = malloc(sizeof(char *) * (nb_words + 1));
+    size_t size     = sizeof(char *) * (nb_words + 1);
+    char **result   = arena != NULL ? arena_alloc(arena, size) : malloc(size);
 
     if (result == NULL)
         return (NULL);
@@ -94,10 +124,15 @@ char **split(const char *str, const char *charset)
     for (size_t i = 0; i < nb_words; ++i) {
         tmp += skip_charset(tmp, charset);
 
-        size_t len  = word_len(tmp, charset);
-        char  *word = safe_strndup(tmp, len);
+        size_t len = word_len(tmp, charset);
+        char  *word;
+        if (arena != NULL)
+            word = arena_strndup(arena, tmp, len);
+        else
+            word = safe_strndup(tmp, len);
         if (word == NULL) {
-            cleanup_split(result, i);
+            if (arena == NULL)
+                cleanup_split(result, i);
             return (NULL);
         }
         result[i] = word;
@@ -107,6 +142,17 @@ char **split(const char *str, const char *charset)
     return (result);
 }
 
+/**
+ * Splits a string into an array of strings using a charset.
+ * @param str The string to split.
+ * @param charset The charset used to split the string.
+ * @return An array of strings or NULL if an error occurred.
+ */
+char **split(const char *str, const char *charset)
+{
+    return (split_words(NULL, str, charset));
+}
+
 void free_split(char **split)
 {
     for (size_t i = 0; split[i] != NULL; ++i)
@@ -114,6 +160,102 @@ void free_split(char **split)
     free(split);
 }
 
+/**
+ * Splits a string with the parse-time allocator of a context.
+ * @param argus The context, its arena serves the allocations if it has one.
+ * @param str The string to split.
+ * @param charset The charset used to split the string.
+ * @return An array of strings or NULL if an error occurred.
+ */
+char **parse_split(argus_t *argus, const char *str, const char *charset)
+{
+    return (split_words(argus->arena, str, charset));
+}
+
+void parse_free_split(argus_t *argus, char **split)
+{
+    if (argus->arena == NULL)
+        free_split(split);
+}
+
+/**
+ * Cuts the next word out of a string in place, skipping empty words like split().
+ * @param cursor Position in the string, moved past the word and its separator.
+ * @param charset The charset separating the words.
+ * @return The word, NUL-terminated in place, or NULL when no word is left.
+ */
+char *split_next(char **cursor, const char *charset)
+{
+    char *word = *cursor + skip_charset(*cursor, charset);
+
+    if (*word == '\0') {
+        *cursor = word;
+        return (NULL);
+    }
+
+    char *end = word + word_len(word, charset);
+    if (*end != '\0')
+        *end++ = '\0';
+    *cursor = end;
+    return (word);
+}
+
+/**
+ * Cuts the next shell-style word out of a buffer in place.
+ * Words are separated by whitespace. Single quotes keep their contents as is,
+ * inside double quotes a backslash only escapes '"' and '\\', and outside of
+ * quotes it escapes any character. Quotes and escapes are removed by moving
+ * the rest of the word back over them.
+ * @param cursor Position in the buffer, moved past the word and its separator.
+ * @param end End of the buffer, the byte it points to must be writable.
+ * @param word Set to the word, NUL-terminated in place.
+ * @param quoted Set when the word starts with a quote or an escape.
+ * @return 1 if a word was cut, 0 at the end of the buffer, -1 if a quote is left open.
+ */
+int shell_word_next(char **cursor, char *end, char **word, bool *quoted)
+{
+    char *p = *cursor;
+
+    while (p < end && isspace((unsigned char)*p))
+        p++;
+    *cursor = p;
+    if (p == end)
+        return (0);
+
+    char *out   = p;
+    char  quote = '\0';
+
+    *word   = p;
+    *quoted = *p == '\'' || *p == '"' || *p == '\\';
+    for (; p < end; ++p) {
+        char c = *p;
+
+        if (quote == '\'') {
+            if (c == '\'')
+                quote = '\0';
+            else
+                *out++ = c;
+        } else if (c == '\\' && p + 1 < end && (quote == '\0' || p[1] == '"' || p[1] == '\\')) {
+            *out++ = *++p;
+        } else if (c == '"') {
+            quote = quote == '"' ? '\0' : '"';
+        } else if (quote == '\0' && c == '\'') {
+            quote = '\'';
+        } else if (quote == '\0' && isspace((unsigned char)c)) {
+            break;
+        } else {
+            *out++ = c;
+        }
+    }
+    if (quote != '\0')
+        return (-1);
+
+    // out never passes p, so the terminator only overwrites bytes already read
+    *cursor = p < end ? p + 1 : end;
+    *out    = '\0';
+    return (1);
+}
+
 /**
  * Writes a character to stdout multiple times.
  * @param c The character to write.
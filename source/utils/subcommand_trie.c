@@ -0,0 +1,212 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 lucocozz
+ *
+ * This file is part of Argus.
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argus/internal/subcommand_trie.h"
+#include "argus/types.h"
+
+static size_t common_prefix(const char *a, size_t a_len, const char *b, size_t b_len)
+{
+    size_t len = a_len < b_len ? a_len : b_len;
+    size_t i   = 0;
+
+    while (i < len && a[i] == b[i])
+        i++;
+    return (i);
+}
+
+static uint32_t *find_child_link(subcommand_trie_t *trie, uint32_t node, char c)
+{
+    uint32_t *link = &trie->nodes[node].child;
+
+    while (*link != 0 && trie->nodes[*link].label[0] != c)
+        link = &trie->nodes[*link].sibling;
+    return (link);
+}
+
+static uint32_t find_child(const subcommand_trie_t *trie, uint32_t node, char c)
+{
+    uint32_t child = trie->nodes[node].child;
+
+    while (child != 0 && trie->nodes[child].label[0] != c)
+        child = trie->nodes[child].sibling;
+    return (child);
+}
+
+static void trie_insert(subcommand_trie_t *trie, const char *name, uint32_t slot)
+{
+    size_t   len  = strlen(name);
+    size_t   pos  = 0;
+    uint32_t node = 0;
+
+    trie->nodes[0].count++;
+    if (trie->nodes[0].first == 0)
+        trie->nodes[0].first = slot;
+
+    while (pos < len) {
+        uint32_t *link = find_child_link(trie, node, name[pos]);
+
+        if (*link == 0) {
+            uint32_t leaf     = trie->node_count++;
+            trie->nodes[leaf] = (subcommand_node_t){
+                .label     = name + pos,
+                .label_len = len - pos,
+                .terminal  = slot,
+                .first     = slot,
+                .count     = 1,
+            };
+            *link = leaf;
+            return;
+        }
+
+        uint32_t child = *link;
+        size_t   k = common_prefix(trie->nodes[child].label, trie->nodes[child].label_len,
+                                   name + pos, len - pos);
+
+        // Split the edge where the new name diverges from it
+        if (k < trie->nodes[child].label_len) {
+            uint32_t split     = trie->node_count++;
+            trie->nodes[split] = (subcommand_node_t){
+                .label     = trie->nodes[child].label,
+                .label_len = k,
+                .child     = child,
+                .sibling   = trie->nodes[child].sibling,
+                .first     = trie->nodes[child].first,
+                .count     = trie->nodes[child].count,
+            };
+            trie->nodes[child].label += k;
+            trie->nodes[child].label_len -= k;
+            trie->nodes[child].sibling = 0;
+            *link                      = split;
+            child                      = split;
+        }
+        trie->nodes[child].count++;
+        node = child;
+        pos += k;
+    }
+    trie->nodes[node].terminal = slot;
+}
+
+subcommand_trie_t *subcommand_trie_build(argus_option_t *options)
+{
+    size_t subcommand_count = 0;
+
+    for (size_t i = 0; options[i].type != TYPE_NONE; ++i) {
+        if (options[i].type == TYPE_SUBCOMMAND)
+            subcommand_count++;
+    }
+
+    subcommand_trie_t *trie = calloc(1, sizeof(subcommand_trie_t));
+    if (trie == NULL)
+        return (NULL);
+
+    // Each insertion adds at most a leaf and a split node
+    trie->nodes = calloc(subcommand_count * 2 + 1, sizeof(subcommand_node_t));
+    if (trie->nodes == NULL) {
+        free(trie);
+        return (NULL);
+    }
+    trie->options    = options;
+    trie->node_count = 1;
+
+    for (size_t i = 0; options[i].type != TYPE_NONE; ++i) {
+        if (options[i].type != TYPE_SUBCOMMAND || options[i].name == NULL)
+            continue;
+
+        // Keep the first declaration of a duplicated name
+        subcommand_match_t match;
+        subcommand_trie_match(trie, options[i].name, &match);
+        if (match.option != NULL && strcmp(match.option->name, options[i].name) == 0)
+            continue;
+        trie_insert(trie, options[i].name, (uint32_t)(i + 1));
+    }
+    return (trie);
+}
+
+void subcommand_trie_free(subcommand_trie_t *trie)
+{
+    if (trie == NULL)
+        return;
+    free(trie->nodes);
+    free(trie);
+}
+
+void subcommand_trie_match(const subcommand_trie_t *trie, const char *name,
+                           subcommand_match_t *match)
+{
+    size_t   len   = strlen(name);
+    size_t   pos   = 0;
+    uint32_t node  = 0;
+    bool     exact = true;
+
+    *match = (subcommand_match_t){0};
+    while (pos < len) {
+        uint32_t child = find_child(trie, node, name[pos]);
+        if (child == 0)
+            return;
+
+        const subcommand_node_t *edge = &trie->nodes[child];
+        size_t k = common_prefix(edge->label, edge->label_len, name + pos, len - pos);
+        if (k < edge->label_len) {
+            // The token must end inside the edge to be an abbreviation
+            if (pos + k < len)
+                return;
+            exact = false;
+        }
+        node = child;
+        pos += k;
+    }
+
+    const subcommand_node_t *found = &trie->nodes[node];
+    match->node                    = node;
+    if (exact && found->terminal != 0) {
+        match->option = &trie->options[found->terminal - 1];
+        match->count  = 1;
+        return;
+    }
+    match->count = found->count;
+    if (found->count == 1)
+        match->option = &trie->options[found->first - 1];
+}
+
+static void collect_candidates(const subcommand_trie_t *trie, uint32_t node,
+                               argus_option_t **candidates, size_t max, size_t *count)
+{
+    const subcommand_node_t *current = &trie->nodes[node];
+
+    if (current->terminal != 0 && *count < max)
+        candidates[(*count)++] = &trie->options[current->terminal - 1];
+    for (uint32_t child = current->child; child != 0; child = trie->nodes[child].sibling)
+        collect_candidates(trie, child, candidates, max, count);
+}
+
+static int compare_candidates(const void *a, const void *b)
+{
+    uintptr_t left  = (uintptr_t)*(argus_option_t *const *)a;
+    uintptr_t right = (uintptr_t)*(argus_option_t *const *)b;
+
+    return ((left > right) - (left < right));
+}
+
+size_t subcommand_trie_candidates(const subcommand_trie_t *trie, const subcommand_match_t *match,
+                                  argus_option_t **candidates, size_t max)
+{
+    size_t count = 0;
+
+    if (match->count == 0)
+        return (0);
+    collect_candidates(trie, match->node, candidates, max, &count);
+
+    // Candidates live in a single options array: address order is declaration order
+    qsort(candidates, count, sizeof(*candidates), compare_candidates);
+    return (count);
+}
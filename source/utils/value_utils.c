@@ -7,24 +7,120 @@
  * See LICENSE file in the project root for full license information.
  */
 
+#include "argus/internal/utils.h"
 #include "argus/types.h"
 
 #include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 void free_option_value(argus_option_t *option)
 {
-    if (option->is_allocated == false)
+    if (option->is_allocated == false) {
+        // Arena-backed key indexes go away with the arena
+        option->map_slots = NULL;
         return;
+    }
 
+    free(option->map_slots);
+    option->map_slots = NULL;
     if (option->free_handler != NULL)
         option->free_handler(option);
     else
         free(option->value.as_ptr);
-    option->is_allocated = false;
-    option->value.as_ptr = NULL;
+    option->is_allocated   = false;
+    option->value.as_ptr   = NULL;
+    option->value_count    = 0;
+    option->value_capacity = 0;
+}
+
+void release_option_string(argus_t *argus, argus_option_t *option, void *str)
+{
+    // Borrowed strings point into argv
+    if (!(option->flags & FLAG_BORROW))
+        parse_release(argus, str);
+}
+
+void reset_option_value(argus_option_t *option)
+{
+    argus_valtype_t multi = VALUE_TYPE_ARRAY | VALUE_TYPE_MAP | VALUE_TYPE_VARIADIC;
+
+    // Owned arrays and maps keep their buffer so the next parse can reuse it
+    if (option->is_allocated && (option->value_type & multi)) {
+        clear_multi_values(option);
+    } else {
+        free_option_value(option);
+        option->value = option->default_value;
+    }
+    option->value_count = 0;
+    option->sink_count  = 0;
+    option->is_set      = option->have_default;
+}
+
+static void store_integer(void *field, size_t size, int64_t value)
+{
+    switch (size) {
+        case sizeof(int8_t): {
+            int8_t narrow = (int8_t)value;
+            memcpy(field, &narrow, size);
+            break;
+        }
+        case sizeof(int16_t): {
+            int16_t narrow = (int16_t)value;
+            memcpy(field, &narrow, size);
+            break;
+        }
+        case sizeof(int32_t): {
+            int32_t narrow = (int32_t)value;
+            memcpy(field, &narrow, size);
+            break;
+        }
+        case sizeof(int64_t):
+            memcpy(field, &value, size);
+            break;
+    }
+}
+
+void bind_option_value(argus_t *argus, argus_option_t *option)
+{
+    if (argus->bind_target == NULL || option->bind_size == 0)
+        return;
+
+    char         *field = (char *)argus->bind_target + option->bind_offset;
+    argus_value_t value = option->value;
+
+    if (option->value_type & VALUE_TYPE_INT)
+        store_integer(field, option->bind_size, value.as_int64);
+    else if (option->value_type & VALUE_TYPE_ANY_BOOL)
+        store_integer(field, option->bind_size, value.as_bool);
+    else if (option->value_type & VALUE_TYPE_FLOAT) {
+        if (option->bind_size == sizeof(float)) {
+            float narrow = (float)value.as_float;
+            memcpy(field, &narrow, sizeof(float));
+        } else if (option->bind_size == sizeof(double))
+            memcpy(field, &value.as_float, sizeof(double));
+    } else if (option->bind_size == sizeof(void *)) {
+        // Strings, collections and custom values are bound by pointer
+        memcpy(field, &value.as_ptr, sizeof(void *));
+    }
+
+    if (option->bind_count_size != 0) {
+        char *count = (char *)argus->bind_target + option->bind_count_offset;
+        store_integer(count, option->bind_count_size, (int64_t)option->value_count);
+    }
+}
+
+void unbind_option_value(argus_t *argus, argus_option_t *option)
+{
+    if (argus->bind_target == NULL || option->bind_size == 0)
+        return;
+
+    memset((char *)argus->bind_target + option->bind_offset, 0, option->bind_size);
+    if (option->bind_count_size != 0)
+        memset((char *)argus->bind_target + option->bind_count_offset, 0,
+               option->bind_count_size);
 }
 
 argus_value_t choices_to_value(argus_valtype_t type, argus_value_t choices, size_t choices_count,
@@ -197,6 +197,120 @@ Test(api, argus_count)
     argus_free(&argus);
 }
 
+// Test option handles resolved once with argus_resolve
+Test(api, argus_resolve_handles)
+{
+    char *argv[] = {"test_program", "-v", "-n", "100", "input.txt", "--array=1,2,3",
+                    "--map=one=1,two=2"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(api_test_options, "test_program", "1.0.0");
+    argus_parse(&argus, argc, argv);
+
+    argus_handle_t verbose = argus_resolve(&argus, "verbose");
+    argus_handle_t number = argus_resolve(&argus, "number");
+    argus_handle_t output = argus_resolve(&argus, "output");
+    argus_handle_t input = argus_resolve(&argus, "input");
+    argus_handle_t array = argus_resolve(&argus, "array");
+    argus_handle_t map = argus_resolve(&argus, "map");
+
+    cr_assert(argus_handle_valid(verbose), "Handle should be resolved");
+    cr_assert(argus_handle_bool(verbose), "Boolean value should be correct");
+    cr_assert_eq(argus_handle_int(number), 100, "Integer value should be correct");
+    cr_assert_str_eq(argus_handle_string(input), "input.txt", "String value should be correct");
+    cr_assert_str_eq(argus_handle_string(output), "output.txt", "Default value should be read");
+
+    cr_assert_eq(argus_handle_count(array), 3, "Array option should have count 3");
+    cr_assert_eq(argus_handle_array_get(array, 2).as_int, 3, "Array element should be correct");
+    cr_assert_eq(argus_handle_array_get(array, 3).raw, 0, "Out of bounds should return empty value");
+    cr_assert_eq(argus_handle_map_get(map, "two").as_int, 2, "Map value should be correct");
+    cr_assert_eq(argus_handle_map_get(map, "three").raw, 0, "Missing key should return empty value");
+    cr_assert_eq(argus_handle_map_get(number, "one").raw, 0, "Non-map should return empty value");
+
+    // Same values as the path-based API
+    cr_assert_eq(argus_handle_get(number).raw, argus_get(&argus, "number").raw,
+                 "Handle and path access should agree");
+
+    // Clean up
+    argus_free(&argus);
+}
+
+// Test argus_resolve with a path that matches nothing
+Test(api, argus_resolve_invalid)
+{
+    char *argv[] = {"test_program", "input.txt"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(api_test_options, "test_program", "1.0.0");
+    argus_parse(&argus, argc, argv);
+
+    argus_handle_t handle = argus_resolve(&argus, "nonexistent");
+    cr_assert_not(argus_handle_valid(handle), "Handle should be invalid");
+    cr_assert_eq(argus.error_code, ARGUS_ERROR_NO_VALUE, "Error code should be set");
+    cr_assert_not(argus_handle_is_set(handle), "Invalid handle should not be set");
+    cr_assert_eq(argus_handle_count(handle), 0, "Invalid handle should have count 0");
+    cr_assert_eq(argus_handle_get(handle).raw, 0, "Invalid handle should return empty value");
+    cr_assert_null(argus_handle_string(handle), "Invalid handle should return NULL string");
+    cr_assert_eq(argus_handle_array_get(handle, 0).raw, 0, "Invalid handle should be safe");
+
+    // Clean up
+    argus_free(&argus);
+}
+
+// Test argus_resolve with subcommand paths
+Test(api, argus_resolve_subcommand)
+{
+    char *argv[] = {"test_program", "sub", "-d"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(api_cmd_options, "test_program", "1.0.0");
+    argus_parse(&argus, argc, argv);
+
+    argus_handle_t relative = argus_resolve(&argus, "debug");
+    argus_handle_t absolute = argus_resolve(&argus, "sub.debug");
+    argus_handle_t root = argus_resolve(&argus, ".verbose");
+
+    cr_assert(argus_handle_is_set(relative), "Relative path should resolve in the subcommand");
+    cr_assert(argus_handle_is_set(absolute), "Subcommand path should resolve");
+    cr_assert(argus_handle_valid(root), "Root path should resolve");
+    cr_assert_not(argus_handle_is_set(root), "Root flag should not be set");
+
+    // Clean up
+    argus_free(&argus);
+}
+
+// Options with compile-time IDs
+#define API_ID_OPTIONS(X)                                                   \
+    X(help, HELP_OPTION())                                                  \
+    X(verbose, OPTION_FLAG('v', "verbose", HELP("Verbose output")))         \
+    X(level, OPTION_INT('l', "level", HELP("Level")))                       \
+    X(tags, OPTION_ARRAY_STRING('t', "tags", HELP("Tags")))
+
+ARGUS_OPTIONS_IDS(api_id_options, API_ID_OPTIONS)
+
+// Test option access through generated IDs
+Test(api, argus_get_by_id)
+{
+    char *argv[] = {"test_program", "-v", "--level=3", "--tags=a,b"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(api_id_options, "test_program", "1.0.0");
+    argus_parse(&argus, argc, argv);
+
+    // IDs are the indices of the options in the array
+    cr_assert_eq(OPT_help, 0, "First option should have ID 0");
+    cr_assert_str_eq(api_id_options[OPT_level].name, "level", "ID should match the option");
+
+    cr_assert(argus_is_set_by_id(&argus, OPT_verbose), "Verbose option should be set");
+    cr_assert_eq(argus_get_by_id(&argus, OPT_level).as_int, 3, "Integer value should be correct");
+    cr_assert_eq(argus_count_by_id(&argus, OPT_tags), 2, "Array option should have count 2");
+    cr_assert_eq(argus_get_by_id(&argus, OPT_level).raw, argus_get(&argus, "level").raw,
+                 "ID and path access should agree");
+
+    // Clean up
+    argus_free(&argus);
+}
+
 // Test argus_print functions (minimal test to ensure they don't crash)
 Test(api, argus_print_functions, .init = cr_redirect_stdout)
 {
@@ -0,0 +1,123 @@
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include "argus.h"
+#include <stdint.h>
+#include <string.h>
+
+typedef struct
+{
+    bool           verbose;
+    int            workers;
+    int16_t        retries;
+    int64_t        limit;
+    float          ratio;
+    double         threshold;
+    const char    *output;
+    argus_value_t *tags;
+    size_t         tag_count;
+    argus_pair_t  *labels;
+    int            label_count;
+    const char    *input;
+    argus_value_t *files;
+} bind_config_t;
+
+ARGUS_OPTIONS(
+    bind_options,
+    OPTION_FLAG('v', "verbose", HELP("Verbose output"), BIND(bind_config_t, verbose)),
+    OPTION_INT('w', "workers", HELP("Worker count"), DEFAULT(4), BIND(bind_config_t, workers)),
+    OPTION_INT('r', "retries", HELP("Retry count"), BIND(bind_config_t, retries)),
+    OPTION_INT('l', "limit", HELP("Limit"), BIND(bind_config_t, limit)),
+    OPTION_FLOAT('R', "ratio", HELP("Ratio"), BIND(bind_config_t, ratio)),
+    OPTION_FLOAT('t', "threshold", HELP("Threshold"), BIND(bind_config_t, threshold)),
+    OPTION_STRING('o', "output", HELP("Output file"), DEFAULT("out.txt"),
+                  BIND(bind_config_t, output)),
+    OPTION_ARRAY_STRING('T', "tags", HELP("Tags"), BIND(bind_config_t, tags, tag_count)),
+    OPTION_MAP_INT('L', "labels", HELP("Labels"), BIND(bind_config_t, labels, label_count)),
+    POSITIONAL_STRING("input", HELP("Input file"), BIND(bind_config_t, input)),
+    POSITIONAL_MANY_STRING("files", HELP("Extra files"), FLAGS(FLAG_OPTIONAL),
+                           BIND(bind_config_t, files)),
+)
+
+Test(bind, defaults_written_on_bind)
+{
+    bind_config_t config = {0};
+    argus_t       argus  = argus_init(bind_options, "test", "1.0.0");
+
+    argus_bind(&argus, &config);
+    cr_assert_eq(config.workers, 4, "Default integer should be bound");
+    cr_assert_str_eq(config.output, "out.txt", "Default string should be bound");
+    cr_assert_not(config.verbose, "Unset flag should be left untouched");
+    argus_free(&argus);
+}
+
+Test(bind, values_written_while_parsing)
+{
+    char *argv[] = {"test", "-v", "--workers=8", "--retries", "-3", "--limit=5000000000",
+                    "--ratio=0.5", "--threshold=1.25", "--tags=a,b,c", "--labels=x=1,y=2",
+                    "input.txt", "one", "two"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    bind_config_t config = {0};
+    argus_t       argus  = argus_init(bind_options, "test", "1.0.0");
+
+    argus_bind(&argus, &config);
+    int status = argus_parse(&argus, argc, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing should succeed");
+
+    cr_assert(config.verbose, "Flag should be bound");
+    cr_assert_eq(config.workers, 8, "Integer should be bound");
+    cr_assert_eq(config.retries, -3, "Narrow integer should be bound");
+    cr_assert_eq(config.limit, 5000000000LL, "64-bit integer should be bound");
+    cr_assert_float_eq(config.ratio, 0.5f, 1e-6, "Float should be bound");
+    cr_assert_float_eq(config.threshold, 1.25, 1e-9, "Double should be bound");
+    cr_assert_str_eq(config.output, "out.txt", "Default string should stay bound");
+    cr_assert_str_eq(config.input, "input.txt", "Positional should be bound");
+
+    cr_assert_eq(config.tags, argus_get(&argus, "tags").as_array, "Array should be bound");
+    cr_assert_str_eq(config.tags[2].as_string, "c", "Array elements should be reachable");
+    cr_assert_eq(config.tag_count, 3, "Array count should be bound");
+    cr_assert_eq(config.labels, argus_get(&argus, "labels").as_map, "Map should be bound");
+    cr_assert_str_eq(config.labels[1].key, "y", "Map entries should be reachable");
+    cr_assert_eq(config.label_count, 2, "Map count should be bound");
+    cr_assert_eq(config.files, argus_get(&argus, "files").as_array, "Variadic should be bound");
+    cr_assert_str_eq(config.files[1].as_string, "two", "Variadic values should be reachable");
+
+    argus_free(&argus);
+}
+
+Test(bind, unbound_context_leaves_struct_untouched)
+{
+    char *argv[] = {"test", "--workers=8", "input.txt"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    bind_config_t config = {.workers = 1};
+    argus_t       argus  = argus_init(bind_options, "test", "1.0.0");
+
+    int status = argus_parse(&argus, argc, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing should succeed");
+    cr_assert_eq(config.workers, 1, "Struct should not be written without argus_bind");
+    cr_assert_eq(argus_get(&argus, "workers").as_int, 8, "Value should still be accessible");
+    argus_free(&argus);
+}
+
+Test(bind, reset_clears_fields_without_default)
+{
+    char *first[]  = {"test", "-v", "--retries=2", "--tags=a,b", "-o", "first.txt", "in.txt"};
+    char *second[] = {"test", "in.txt"};
+
+    bind_config_t config = {0};
+    argus_t       argus  = argus_init(bind_options, "test", "1.0.0");
+
+    argus_bind(&argus, &config);
+    cr_assert_eq(argus_parse(&argus, 7, first), ARGUS_SUCCESS, "First parse should succeed");
+
+    argus_reset(&argus);
+    cr_assert_eq(argus_parse(&argus, 2, second), ARGUS_SUCCESS, "Second parse should succeed");
+    cr_assert_not(config.verbose, "Flag field should be cleared");
+    cr_assert_eq(config.retries, 0, "Integer field should be cleared");
+    cr_assert_null(config.tags, "Array field should be cleared");
+    cr_assert_eq(config.tag_count, 0, "Array count should be cleared");
+    cr_assert_str_eq(config.output, "out.txt", "Default should be bound again");
+    cr_assert_str_eq(config.input, "in.txt", "New value should be bound");
+    argus_free(&argus);
+}
@@ -168,3 +168,46 @@ Test(env_vars, no_env_prefix_flag, .init = setup_env, .fini = teardown_env)
     unsetenv("TEST_DATABASE_URL");
     argus_free(&argus);
 }
+
+// Test that the variable names follow a prefix changed between parses
+Test(env_vars, prefix_changed_between_parses, .init = setup_env, .fini = teardown_env)
+{
+    argus_t argus = argus_init(env_options, "test_program", "1.0.0");
+    argus.env_prefix = "TEST";
+    setenv("OTHER_HOST", "other.example.com", 1);
+
+    cr_assert_eq(load_env_vars(&argus), ARGUS_SUCCESS);
+    argus_option_t *host_option = find_option_by_name(env_options, "host");
+    cr_assert_str_eq(host_option->value.as_string, "env-server.example.com");
+
+    argus_reset(&argus);
+    argus.env_prefix = "OTHER";
+    cr_assert_eq(load_env_vars(&argus), ARGUS_SUCCESS);
+    cr_assert_str_eq(host_option->value.as_string, "other.example.com",
+                     "Host should be read from the new prefix");
+
+    unsetenv("OTHER_HOST");
+    argus_free(&argus);
+}
+
+// Test variable names longer than any fixed buffer
+Test(env_vars, long_variable_name)
+{
+    char name[300];
+    memset(name, 'A', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    setenv(name, "long", 1);
+
+    argus_option_t options[] = {
+        HELP_OPTION(),
+        OPTION_STRING('l', "long", HELP("Long name"), ENV_VAR(name), FLAGS(FLAG_NO_ENV_PREFIX)),
+        OPTION_END(),
+    };
+    argus_t argus = argus_init(options, "test_program", "1.0.0");
+
+    cr_assert_eq(load_env_vars(&argus), ARGUS_SUCCESS);
+    cr_assert_str_eq(argus_get(&argus, "long").as_string, "long");
+
+    unsetenv(name);
+    argus_free(&argus);
+}
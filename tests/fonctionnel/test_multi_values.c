@@ -182,3 +182,83 @@ Test(multi_value_access, argus_map_it)
     // Clean up
     argus_free(&argus);
 }
+
+ARGUS_OPTIONS(
+    borrow_options,
+    OPTION_ARRAY_STRING('s', "strings", HELP("Array of strings"), FLAGS(FLAG_BORROW | FLAG_UNIQUE)),
+    OPTION_MAP_STRING('m', "map", HELP("String map"), FLAGS(FLAG_BORROW)),
+    OPTION_MAP_INT('p', "ports", HELP("Port map"), FLAGS(FLAG_BORROW), ENV_VAR("PORTS")),
+    POSITIONAL_MANY_STRING("files", HELP("Files"), FLAGS(FLAG_BORROW | FLAG_OPTIONAL)),
+)
+
+// Borrowed values point into argv, which must be writable
+Test(multi_value_borrow, values_point_into_argv)
+{
+    char strings[] = "--strings=a,b,a";
+    char map[]     = "--map=k=v,x=y";
+    char file[]    = "file.txt";
+    char *argv[]   = {"test_program", strings, map, file};
+
+    argus_t argus = argus_init(borrow_options, "test_program", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, 4, argv), ARGUS_SUCCESS, "Parsing should succeed");
+
+    cr_assert_eq(argus_count(&argus, "strings"), 2, "Duplicates should be dropped");
+    cr_assert_eq(argus_array_get(&argus, "strings", 0).as_string, strings + 10,
+                 "Array values should point into the token");
+    cr_assert_str_eq(argus_array_get(&argus, "strings", 1).as_string, "b", "Value should be cut");
+
+    cr_assert_str_eq(argus_map_get(&argus, "map", "x").as_string, "y", "Map value should be set");
+    cr_assert_eq(argus_map_get(&argus, "map", "k").as_string, map + 8,
+                 "Map values should point into the token");
+    cr_assert_eq(argus_array_get(&argus, "files", 0).as_string, file,
+                 "Variadic values should be the argv entries");
+    argus_free(&argus);
+}
+
+Test(multi_value_borrow, environment_untouched)
+{
+    setenv("PORTS", "http=80,https=443", 1);
+    char *argv[] = {"test_program"};
+
+    argus_t argus = argus_init(borrow_options, "test_program", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, 1, argv), ARGUS_SUCCESS, "Parsing should succeed");
+    cr_assert_eq(argus_map_get(&argus, "ports", "https").as_int, 443, "Map should be loaded");
+    cr_assert_str_eq(getenv("PORTS"), "http=80,https=443", "Environment should not be cut");
+    argus_free(&argus);
+    unsetenv("PORTS");
+}
+
+ARGUS_OPTIONS(
+    flagged_options,
+    HELP_OPTION(),
+    OPTION_ARRAY_INT('i', "ints", HELP("Sorted unique integers"), FLAGS(FLAG_SORTED | FLAG_UNIQUE)),
+    OPTION_MAP_INT('p', "ports", HELP("Ports sorted by key"), FLAGS(FLAG_SORTED_KEY)),
+)
+
+// Flags apply to the whole collection once every occurrence is collected
+Test(multi_value_flags, applied_after_all_occurrences)
+{
+    char *argv[] = {"test", "-i", "5,3", "-i", "3", "-i", "1,5,4", "-p", "web=80",
+                    "-p", "db=5432,api=8080", "-p", "web=8000"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    argus_t argus  = argus_init(flagged_options, "test", "1.0.0");
+    int     status = argus_parse(&argus, argc, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing should succeed");
+
+    int64_t expected[] = {1, 3, 4, 5};
+    cr_assert_eq(argus_count(&argus, "ints"), 4, "Duplicates should be removed");
+    for (size_t i = 0; i < 4; ++i)
+        cr_assert_eq(argus_array_get(&argus, "ints", i).as_int64, expected[i],
+                     "Values should be sorted across occurrences");
+
+    const char *keys[] = {"api", "db", "web"};
+    cr_assert_eq(argus_count(&argus, "ports"), 3, "Updated key should not be duplicated");
+    argus_map_it_t it = argus_map_it(&argus, "ports");
+    for (size_t i = 0; argus_map_next(&it); ++i)
+        cr_assert_str_eq(it.key, keys[i], "Keys should be sorted across occurrences");
+    cr_assert_eq(argus_map_get(&argus, "ports", "web").as_int, 8000, "Last value should win");
+    cr_assert_eq(argus_map_get(&argus, "ports", "api").as_int, 8080, "Index should follow sorting");
+
+    argus_free(&argus);
+}
@@ -0,0 +1,130 @@
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include "argus.h"
+
+ARGUS_OPTIONS(
+    reset_sub_options,
+    OPTION_FLAG('f', "force", HELP("Force")),
+    OPTION_ARRAY_INT('n', "numbers", HELP("Numbers")),
+)
+
+ARGUS_OPTIONS(
+    reset_options,
+    OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+    OPTION_INT('n', "number", HELP("A number"), DEFAULT(3)),
+    OPTION_STRING('o', "output", HELP("Output file"), DEFAULT("out.txt")),
+    OPTION_ARRAY_INT('i', "ids", HELP("Identifiers")),
+    OPTION_MAP_STRING('e', "env", HELP("Environment")),
+    SUBCOMMAND("run", reset_sub_options, HELP("Run something")),
+)
+
+Test(reset, restores_defaults)
+{
+    char *argv[] = {"test", "-v", "--number=7", "--output=x", "--ids=1,2", "-e", "a=b"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(reset_options, "test", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, argc, argv), ARGUS_SUCCESS, "Parsing should succeed");
+
+    argus_reset(&argus);
+    cr_assert_not(argus_is_set(&argus, "verbose"), "Flag should no longer be set");
+    cr_assert(argus_is_set(&argus, "number"), "Option with a default should stay set");
+    cr_assert_eq(argus_get(&argus, "number").as_int, 3, "Default value should be restored");
+    cr_assert_str_eq(argus_get(&argus, "output").as_string, "out.txt", "Default should be restored");
+    cr_assert_eq(argus_count(&argus, "ids"), 0, "Array should be emptied");
+    cr_assert_eq(argus_count(&argus, "env"), 0, "Map should be emptied");
+    cr_assert_not(argus_is_set(&argus, "ids"), "Array should no longer be set");
+    argus_free(&argus);
+}
+
+Test(reset, keeps_buffers)
+{
+    char *first[]  = {"test", "--ids=1,2,3", "-e", "a=1,b=2"};
+    char *second[] = {"test", "--ids=4,5", "-e", "c=3"};
+
+    argus_t argus = argus_init(reset_options, "test", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, 4, first), ARGUS_SUCCESS, "First parse should succeed");
+
+    argus_value_t *ids = argus_get(&argus, "ids").as_array;
+    argus_pair_t  *env = argus_get(&argus, "env").as_map;
+
+    argus_reset(&argus);
+    cr_assert_eq(argus_parse(&argus, 4, second), ARGUS_SUCCESS, "Second parse should succeed");
+    cr_assert_eq(argus_get(&argus, "ids").as_array, ids, "Array buffer should be reused");
+    cr_assert_eq(argus_get(&argus, "env").as_map, env, "Map buffer should be reused");
+    cr_assert_eq(argus_count(&argus, "ids"), 2, "Array should only hold the new values");
+    cr_assert_eq(argus_array_get(&argus, "ids", 0).as_int, 4, "Array should hold the new values");
+    cr_assert_eq(argus_count(&argus, "env"), 1, "Map should only hold the new pairs");
+    cr_assert_str_eq(argus_map_get(&argus, "env", "c").as_string, "3", "Map should hold new pairs");
+    cr_assert_null(argus_map_get(&argus, "env", "a").as_string, "Old pairs should be gone");
+    argus_free(&argus);
+}
+
+Test(reset, leaves_subcommands)
+{
+    char *first[]  = {"test", "run", "--force"};
+    char *second[] = {"test", "-v"};
+
+    argus_t argus = argus_init(reset_options, "test", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, 3, first), ARGUS_SUCCESS, "First parse should succeed");
+    cr_assert(argus_has_command(&argus), "A subcommand should be active");
+
+    argus_reset(&argus);
+    cr_assert_not(argus_has_command(&argus), "No subcommand should be active after a reset");
+    cr_assert_not(reset_sub_options[0].is_set, "Sub options should be reset");
+
+    cr_assert_eq(argus_parse(&argus, 2, second), ARGUS_SUCCESS, "Second parse should succeed");
+    cr_assert_not(argus_has_command(&argus), "No subcommand should be active");
+    cr_assert(argus_is_set(&argus, "verbose"), "Flag should be set");
+    argus_free(&argus);
+}
+
+// Buffers of a subcommand left by the reset are released, argus_free no longer reaches them
+Test(reset, releases_left_subcommands)
+{
+    char *first[]  = {"test", "run", "-n", "1,2,3"};
+    char *second[] = {"test", "-v"};
+
+    argus_t argus = argus_init(reset_options, "test", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, 4, first), ARGUS_SUCCESS, "First parse should succeed");
+    cr_assert_eq(argus_count(&argus, "run.numbers"), 3, "Sub array should be set");
+
+    argus_reset(&argus);
+    cr_assert_null(reset_sub_options[1].value.as_array, "Sub array buffer should be released");
+    cr_assert_eq(argus_parse(&argus, 2, second), ARGUS_SUCCESS, "Second parse should succeed");
+    argus_free(&argus);
+}
+
+Test(reset, after_failed_parse, .init = cr_redirect_stderr)
+{
+    char *bad[]  = {"test", "--number=9", "--unknown"};
+    char *good[] = {"test", "--number=5"};
+
+    argus_t argus = argus_init(reset_options, "test", "1.0.0");
+    cr_assert_neq(argus_parse(&argus, 3, bad), ARGUS_SUCCESS, "Unknown option should fail");
+
+    argus_reset(&argus);
+    cr_assert_eq(argus_parse(&argus, 2, good), ARGUS_SUCCESS, "Parsing should succeed again");
+    cr_assert_eq(argus_get(&argus, "number").as_int, 5, "Value should be set");
+    argus_free(&argus);
+}
+
+Test(reset, schema_result)
+{
+    char *bad[]  = {"test", "--unknown"};
+    char *good[] = {"test", "--ids=1", "run", "-f"};
+
+    argus_schema_t *schema = argus_schema_compile(reset_options, "test", "1.0.0");
+    argus_result_t  result = argus_result_init(schema);
+
+    cr_redirect_stderr();
+    cr_assert_neq(argus_parse(&result, 2, bad), ARGUS_SUCCESS, "Unknown option should fail");
+
+    argus_reset(&result);
+    cr_assert_eq(argus_parse(&result, 4, good), ARGUS_SUCCESS, "Parsing should succeed again");
+    cr_assert_eq(argus_count(&result, "ids"), 1, "Array should be set");
+    cr_assert(argus_is_set(&result, "force"), "Sub option should be set");
+
+    argus_free(&result);
+    argus_schema_free(schema);
+}
@@ -0,0 +1,104 @@
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include "argus.h"
+#include <string.h>
+
+ARGUS_OPTIONS(
+    schema_sub_options,
+    OPTION_FLAG('f', "force", HELP("Force")),
+    POSITIONAL_STRING("target", HELP("Target")),
+)
+
+ARGUS_OPTIONS(
+    schema_options,
+    OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+    OPTION_INT('n', "number", HELP("A number")),
+    OPTION_ARRAY_STRING('t', "tags", HELP("Tags")),
+    SUBCOMMAND("add", schema_sub_options, HELP("Add a target")),
+    SUBCOMMAND("remove", schema_sub_options, HELP("Remove a target")),
+)
+
+Test(schema, compile_and_parse)
+{
+    char *argv[] = {"test", "-v", "--number=7", "--tags=a,b"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    argus_schema_t *schema = argus_schema_compile(schema_options, "test", "1.0.0");
+    cr_assert_not_null(schema, "Schema should be compiled");
+
+    argus_result_t result = argus_result_init(schema);
+    cr_assert_eq(result.error_code, ARGUS_SUCCESS, "Result should be created");
+
+    int status = argus_parse(&result, argc, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing should succeed");
+    cr_assert(argus_is_set(&result, "verbose"), "Flag should be set");
+    cr_assert_eq(argus_get(&result, "number").as_int, 7, "Value should be set");
+    cr_assert_eq(argus_count(&result, "tags"), 2, "Array should have 2 values");
+    cr_assert_str_eq(argus_array_get(&result, "tags", 1).as_string, "b", "Value should be set");
+
+    argus_free(&result);
+    argus_schema_free(schema);
+}
+
+Test(schema, declared_options_untouched)
+{
+    char *argv[] = {"test", "-v", "--number=7", "--tags=a,b", "add", "-f", "x"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    argus_schema_t *schema = argus_schema_compile(schema_options, "test", "1.0.0");
+    argus_result_t  result = argus_result_init(schema);
+
+    cr_assert_eq(argus_parse(&result, argc, argv), ARGUS_SUCCESS, "Parsing should succeed");
+    cr_assert_not(schema_options[0].is_set, "Declared flag should not be written");
+    cr_assert_eq(schema_options[2].value_count, 0, "Declared array should not be written");
+    cr_assert_not(schema_sub_options[0].is_set, "Declared sub options should not be written");
+
+    argus_free(&result);
+    argus_schema_free(schema);
+}
+
+Test(schema, results_are_independent)
+{
+    char *argv_a[] = {"test", "--number=1", "--tags=a", "add", "-f", "first"};
+    char *argv_b[] = {"test", "--number=2", "remove", "second"};
+
+    argus_schema_t *schema = argus_schema_compile(schema_options, "test", "1.0.0");
+    argus_result_t  a      = argus_result_init(schema);
+    argus_result_t  b      = argus_result_init(schema);
+
+    cr_assert_eq(argus_parse(&a, 6, argv_a), ARGUS_SUCCESS, "First parse should succeed");
+    cr_assert_eq(argus_parse(&b, 4, argv_b), ARGUS_SUCCESS, "Second parse should succeed");
+
+    cr_assert_eq(argus_get(&a, "number").as_int, 1, "First result should keep its value");
+    cr_assert_eq(argus_get(&b, "number").as_int, 2, "Second result should keep its value");
+    cr_assert_eq(argus_count(&a, "tags"), 1, "First result should have one tag");
+    cr_assert_eq(argus_count(&b, "tags"), 0, "Second result should have no tag");
+
+    cr_assert_str_eq(a.subcommand_stack[0]->name, "add", "First result ran 'add'");
+    cr_assert_str_eq(b.subcommand_stack[0]->name, "remove", "Second result ran 'remove'");
+    cr_assert(argus_is_set(&a, "force"), "Sub option should be set in the first result");
+    cr_assert_not(argus_is_set(&b, "force"), "Sub option should not leak to the second result");
+    cr_assert_str_eq(argus_get(&a, "add.target").as_string, "first", "Positional should be set");
+    cr_assert_str_eq(argus_get(&b, "target").as_string, "second", "Positional should be set");
+
+    argus_free(&a);
+    argus_free(&b);
+    argus_schema_free(schema);
+}
+
+Test(schema, result_reports_parse_errors, .init = cr_redirect_stderr)
+{
+    char *argv[] = {"test", "--unknown"};
+
+    argus_schema_t *schema = argus_schema_compile(schema_options, "test", "1.0.0");
+    argus_result_t  result = argus_result_init(schema);
+
+    cr_assert_neq(argus_parse(&result, 2, argv), ARGUS_SUCCESS, "Unknown option should fail");
+    argus_free(&result);
+
+    // The schema stays usable after a failed parse
+    result = argus_result_init(schema);
+    cr_assert_eq(argus_parse(&result, 1, argv), ARGUS_SUCCESS, "Empty command line should pass");
+    argus_free(&result);
+    argus_schema_free(schema);
+}
@@ -1,5 +1,7 @@
 #include <criterion/criterion.h>
 #include "argus.h"
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -243,4 +245,131 @@ Test(variadic_usage, memory_management)
     
     // If we reach here without crashes, memory management is working
     cr_assert(true, "Memory management test completed successfully");
-}
\ No newline at end of file
+}
+
+// Sink collecting what it is given
+typedef struct
+{
+    size_t  count;
+    int64_t sum;
+    char    last[32];
+} sink_state_t;
+
+static int collect_file(argus_t *argus, argus_value_t value, void *data)
+{
+    sink_state_t *state = data;
+    (void)argus;
+
+    if (strcmp(value.as_string, "bad") == 0)
+        return ARGUS_ERROR_INVALID_VALUE;
+    state->count++;
+    snprintf(state->last, sizeof(state->last), "%s", value.as_string);
+    return ARGUS_SUCCESS;
+}
+
+static int sum_ints(argus_t *argus, argus_value_t value, void *data)
+{
+    sink_state_t *state = data;
+    (void)argus;
+
+    state->count++;
+    state->sum += value.as_int64;
+    return ARGUS_SUCCESS;
+}
+
+// Test values streamed to a sink instead of being stored
+Test(variadic_usage, sink_streams_values)
+{
+    sink_state_t files = {0};
+    sink_state_t ids   = {0};
+    ARGUS_OPTIONS(
+        sink_options,
+        HELP_OPTION(),
+        OPTION_ARRAY_INT('i', "ids", HELP("Identifiers"), SINK(sum_ints, &ids)),
+        POSITIONAL_MANY_STRING("files", HELP("Files to process"), SINK(collect_file, &files)),
+    )
+    char *argv[] = {"test", "--ids=1-100", "-i", "1000", "a.txt", "b.txt", "c.txt"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(sink_options, "test", "1.0.0");
+    int status = argus_parse(&argus, argc, argv);
+
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing with sinks should succeed");
+    cr_assert_eq(files.count, 3, "Sink should receive every file");
+    cr_assert_str_eq(files.last, "c.txt");
+    cr_assert_eq(ids.count, 101, "Ranges should be given one value at a time");
+    cr_assert_eq(ids.sum, 6050);
+
+    cr_assert(argus_is_set(&argus, "files"), "Sink option should be set");
+    cr_assert_eq(argus_count(&argus, "files"), 0, "Sink values should not be stored");
+    cr_assert_eq(argus_array_get(&argus, "files", 0).raw, 0);
+    argus_free(&argus);
+}
+
+// Test a sink rejecting a value
+Test(variadic_usage, sink_rejects_value, .init = cr_redirect_stderr)
+{
+    sink_state_t files = {0};
+    ARGUS_OPTIONS(
+        sink_options,
+        HELP_OPTION(),
+        POSITIONAL_MANY_STRING("files", HELP("Files to process"), SINK(collect_file, &files)),
+    )
+    char *argv[] = {"test", "a.txt", "bad", "c.txt"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(sink_options, "test", "1.0.0");
+    int status = argus_parse(&argus, argc, argv);
+
+    cr_assert_eq(status, ARGUS_ERROR_INVALID_VALUE, "Sink error should stop the parse");
+    cr_assert_eq(files.count, 1, "Values after the rejected one should not reach the sink");
+}
+
+// Test V_COUNT on a sink, counting the values it was given
+Test(variadic_usage, sink_value_count, .init = cr_redirect_stderr)
+{
+    sink_state_t files = {0};
+    ARGUS_OPTIONS(
+        sink_options,
+        HELP_OPTION(),
+        POSITIONAL_MANY_STRING("files", HELP("Files to process"), SINK(collect_file, &files),
+                               VALIDATOR(V_COUNT(2, 3))),
+    )
+    char *enough[] = {"test", "a.txt", "b.txt"};
+    char *too_many[] = {"test", "a.txt", "b.txt", "c.txt", "d.txt"};
+
+    argus_t argus = argus_init(sink_options, "test", "1.0.0");
+    cr_assert_eq(argus_parse(&argus, 3, enough), ARGUS_SUCCESS, "2 values should pass V_COUNT");
+    cr_assert_eq(argus_count(&argus, "files"), 0, "Sink values should not be stored");
+    argus_reset(&argus);
+
+    int status = argus_parse(&argus, 5, too_many);
+    cr_assert_eq(status, ARGUS_ERROR_INVALID_RANGE, "4 values should fail V_COUNT");
+}
+
+// Test an array sink fed one argument at a time, without copying its values
+Test(variadic_usage, sink_fed_values)
+{
+    sink_state_t files = {0};
+    ARGUS_OPTIONS(
+        sink_options,
+        HELP_OPTION(),
+        OPTION_ARRAY_STRING('f', "file", HELP("Files to process"), SINK(collect_file, &files)),
+        OPTION_ARRAY_STRING('I', "include", HELP("Include paths"), FLAGS(FLAG_BORROW),
+                            SINK(collect_file, &files)),
+    )
+    argus_t argus = argus_init(sink_options, "test", "1.0.0");
+
+    for (int i = 0; i < 10000; ++i) {
+        cr_assert_eq(argus_feed(&argus, "--file"), ARGUS_SUCCESS);
+        cr_assert_eq(argus_feed(&argus, "a.txt"), ARGUS_SUCCESS);
+        cr_assert_eq(argus_feed(&argus, "--file=b.txt"), ARGUS_SUCCESS);
+        cr_assert_eq(argus_feed(&argus, "-Ic,d"), ARGUS_SUCCESS);
+    }
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+
+    cr_assert_eq(files.count, 40000, "Sinks should receive every value");
+    cr_assert_str_eq(files.last, "d");
+    cr_assert_null(argus.env_arena, "Values given to a sink should not be copied");
+    argus_free(&argus);
+}
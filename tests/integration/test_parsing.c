@@ -1,4 +1,5 @@
 #include <criterion/criterion.h>
+#include <string.h>
 #include "argus/types.h"
 #include "argus/errors.h"
 #include "argus/internal/utils.h"
@@ -312,3 +313,245 @@ Test(parsing, parse_args_end_options, .init = setup_parsing)
     cr_assert_eq(input->is_set, true, "Input option should be set");
     cr_assert_str_eq(input->value.as_string, "-o", "Input value should be -o");
 }
+
+// Test for argus_parse_line with quotes and escapes
+Test(parsing, parse_line_quotes)
+{
+    char    line[] = "  -v --output 'my file.txt' \"in\\\"put\\\\\"  ";
+    argus_t argus  = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_parse_line(&argus, line), ARGUS_SUCCESS);
+    cr_assert(argus_get(&argus, "verbose").as_bool);
+    cr_assert_str_eq(argus_get(&argus, "output").as_string, "my file.txt");
+    cr_assert_str_eq(argus_get(&argus, "input").as_string, "in\"put\\");
+    argus_free(&argus);
+}
+
+// Test for argus_parse_line reusing its token buffer across resets
+Test(parsing, parse_line_reset)
+{
+    char    first[]  = "--count 1 a";
+    char    second[] = "-c 2 b";
+    argus_t argus    = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_parse_line(&argus, first), ARGUS_SUCCESS);
+    char **tokens = argus.tokens.argv;
+    argus_reset(&argus);
+
+    cr_assert_eq(argus_parse_line(&argus, second), ARGUS_SUCCESS);
+    cr_assert_eq(argus.tokens.argv, tokens, "Token buffer should be reused");
+    cr_assert_eq(argus_get(&argus, "count").as_int, 2);
+    cr_assert_str_eq(argus_get(&argus, "input").as_string, "b");
+    argus_free(&argus);
+}
+
+// Test for argus_parse_line with an unterminated quote
+Test(parsing, parse_line_unterminated_quote, .init = cr_redirect_stderr)
+{
+    char    line[] = "-o 'never closed";
+    argus_t argus  = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_parse_line(&argus, line), ARGUS_ERROR_INVALID_FORMAT);
+}
+
+// Test for argus_parse_packed on a read-only buffer
+Test(parsing, parse_packed_read_only)
+{
+    ARGUS_OPTIONS(
+        packed_options,
+        HELP_OPTION(),
+        OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+        OPTION_STRING('o', "output", HELP("Output file")),
+        OPTION_ARRAY_STRING('I', "include", HELP("Include paths"), FLAGS(FLAG_BORROW)),
+        OPTION_MAP_STRING('D', "define", HELP("Definitions"), FLAGS(FLAG_BORROW)),
+        POSITIONAL_STRING("input", HELP("Input file")),
+    )
+    static const char packed[] = "program\0-v\0--output=out.txt\0-I\0a,b\0-DKEY=value\0in.c";
+    argus_t           argus    = argus_init(packed_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_parse_packed(&argus, packed, sizeof(packed)), ARGUS_SUCCESS);
+    cr_assert(argus_get(&argus, "verbose").as_bool);
+
+    // Values that need no cut point into the buffer
+    const char *output = argus_get(&argus, "output").as_string;
+    cr_assert_str_eq(output, "out.txt");
+    cr_assert(output >= packed && output < packed + sizeof(packed));
+    cr_assert_str_eq(argus_get(&argus, "input").as_string, "in.c");
+
+    // Borrowed values that are split come from a copy, the buffer is left intact
+    cr_assert_eq(argus_count(&argus, "include"), 2);
+    cr_assert_str_eq(argus_array_get(&argus, "include", 1).as_string, "b");
+    cr_assert_str_eq(argus_map_get(&argus, "define", "KEY").as_string, "value");
+    cr_assert_str_eq(packed + sizeof("program\0-v\0--output=out.txt\0-I"), "a,b");
+    argus_free(&argus);
+}
+
+// Test for argus_parse_packed without a final NUL byte
+Test(parsing, parse_packed_unterminated, .init = cr_redirect_stderr)
+{
+    const char packed[] = {'p', '\0', '-', 'v'};
+    argus_t    argus    = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_parse_packed(&argus, packed, sizeof(packed)), ARGUS_ERROR_INVALID_FORMAT);
+}
+
+// Test for argus_feed with values split from their option and a reused buffer
+Test(parsing, feed_reused_buffer)
+{
+    const char *args[] = {"-v", "--output", "out.txt", "-c3", "in.c"};
+    char        buffer[16];
+    argus_t     argus = argus_init(parse_options, "program", "1.0.0");
+
+    for (size_t i = 0; i < sizeof(args) / sizeof(args[0]); ++i) {
+        strcpy(buffer, args[i]);
+        cr_assert_eq(argus_feed(&argus, buffer), ARGUS_SUCCESS);
+    }
+    memset(buffer, 'x', sizeof(buffer) - 1);
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+
+    cr_assert(argus_get(&argus, "verbose").as_bool);
+    cr_assert_str_eq(argus_get(&argus, "output").as_string, "out.txt");
+    cr_assert_eq(argus_get(&argus, "count").as_int, 3);
+    cr_assert_str_eq(argus_get(&argus, "input").as_string, "in.c");
+    argus_free(&argus);
+}
+
+// Test for argus_feed entering a subcommand and stopping options at "--"
+Test(parsing, feed_subcommand)
+{
+    ARGUS_OPTIONS(
+        feed_sub_options,
+        HELP_OPTION(),
+        OPTION_FLAG('d', "debug", HELP("Debug mode")),
+        POSITIONAL_STRING("target", HELP("Target")),
+    )
+    ARGUS_OPTIONS(
+        feed_options,
+        HELP_OPTION(),
+        OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+        SUBCOMMAND("run", feed_sub_options, HELP("Run command")),
+    )
+    const char *args[] = {"-v", "run", "-d", "--", "-target"};
+    argus_t     argus  = argus_init(feed_options, "program", "1.0.0");
+
+    for (size_t i = 0; i < sizeof(args) / sizeof(args[0]); ++i)
+        cr_assert_eq(argus_feed(&argus, args[i]), ARGUS_SUCCESS);
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+
+    cr_assert(argus_get(&argus, "verbose").as_bool);
+    cr_assert(argus_has_command(&argus));
+    cr_assert(argus_get(&argus, "run.debug").as_bool);
+    cr_assert_str_eq(argus_get(&argus, "run.target").as_string, "-target");
+    argus_free(&argus);
+}
+
+// Test for argus_feed dropping every "--" like argus_parse
+Test(parsing, feed_double_separator)
+{
+    // Values live in the option records, so each context gets its own
+    ARGUS_OPTIONS(
+        parse_many_options,
+        HELP_OPTION(),
+        POSITIONAL_MANY_STRING("args", HELP("Arguments")),
+    )
+    ARGUS_OPTIONS(
+        feed_options,
+        HELP_OPTION(),
+        POSITIONAL_MANY_STRING("args", HELP("Arguments")),
+    )
+    char   *argv[] = {"program", "a", "--", "--", "b"};
+    argus_t parsed = argus_init(parse_many_options, "program", "1.0.0");
+    argus_t fed    = argus_init(feed_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_parse(&parsed, 5, argv), ARGUS_SUCCESS);
+    for (int i = 1; i < 5; ++i)
+        cr_assert_eq(argus_feed(&fed, argv[i]), ARGUS_SUCCESS);
+    cr_assert_eq(argus_finish(&fed), ARGUS_SUCCESS);
+
+    cr_assert_eq(argus_count(&fed, "args"), argus_count(&parsed, "args"));
+    for (size_t i = 0; i < argus_count(&parsed, "args"); ++i)
+        cr_assert_str_eq(argus_array_get(&fed, "args", i).as_string,
+                         argus_array_get(&parsed, "args", i).as_string);
+    cr_assert_eq(argus_count(&fed, "args"), 2);
+    argus_free(&parsed);
+    argus_free(&fed);
+}
+
+// Test for argus_feed reading values in place when their handler keeps none of them
+Test(parsing, feed_bounded_memory)
+{
+    ARGUS_OPTIONS(
+        feed_options,
+        HELP_OPTION(),
+        OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+        OPTION_INT('c', "count", HELP("Count value")),
+        OPTION_FLOAT('r', "ratio", HELP("Ratio")),
+        OPTION_STRING('o', "output", HELP("Output file")),
+    )
+    argus_t argus = argus_init(feed_options, "program", "1.0.0");
+
+    for (int i = 0; i < 100000; ++i) {
+        cr_assert_eq(argus_feed(&argus, "-c"), ARGUS_SUCCESS);
+        cr_assert_eq(argus_feed(&argus, "5"), ARGUS_SUCCESS);
+        cr_assert_eq(argus_feed(&argus, "--ratio=0.5"), ARGUS_SUCCESS);
+        cr_assert_eq(argus_feed(&argus, "-vc7"), ARGUS_SUCCESS);
+    }
+    cr_assert_null(argus.env_arena, "Parsed values should not be copied");
+
+    // Only a value the handler points into is copied
+    cr_assert_eq(argus_feed(&argus, "--output=out.txt"), ARGUS_SUCCESS);
+    cr_assert_not_null(argus.env_arena);
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+    cr_assert_eq(argus_get(&argus, "count").as_int, 7);
+    cr_assert_str_eq(argus_get(&argus, "output").as_string, "out.txt");
+    argus_free(&argus);
+}
+
+// Test for argus_reset keeping the buffer of the pending option
+Test(parsing, feed_reset_keeps_pending)
+{
+    argus_t argus = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_feed(&argus, "--output"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_feed(&argus, "first.txt"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_feed(&argus, "in.c"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+    char *pending = argus.feed.pending;
+
+    argus_reset(&argus);
+    cr_assert_eq(argus.feed.pending, pending, "Pending buffer should be kept");
+    cr_assert_eq(argus_feed(&argus, "--output"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_feed(&argus, "second.txt"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_feed(&argus, "in.c"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+    cr_assert_eq(argus.feed.pending, pending, "Pending buffer should be reused");
+    cr_assert_str_eq(argus_get(&argus, "output").as_string, "second.txt");
+    argus_free(&argus);
+}
+
+// Test for argus_finish returning the error of a failed argus_feed
+Test(parsing, feed_error_is_sticky, .init = cr_redirect_stderr)
+{
+    argus_t argus = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_feed(&argus, "--unknown"), ARGUS_ERROR_INVALID_ARGUMENT);
+    cr_assert_eq(argus_feed(&argus, "in.c"), ARGUS_ERROR_INVALID_ARGUMENT,
+                 "Arguments after an error should not be parsed");
+    cr_assert_eq(argus_finish(&argus), ARGUS_ERROR_INVALID_ARGUMENT,
+                 "argus_finish should report the failed argument");
+
+    argus_reset(&argus);
+    cr_assert_eq(argus_feed(&argus, "in.c"), ARGUS_SUCCESS, "A reset should clear the error");
+    cr_assert_eq(argus_finish(&argus), ARGUS_SUCCESS);
+    argus_free(&argus);
+}
+
+// Test for argus_finish with an option still waiting for its value
+Test(parsing, feed_missing_value, .init = cr_redirect_stderr)
+{
+    argus_t argus = argus_init(parse_options, "program", "1.0.0");
+
+    cr_assert_eq(argus_feed(&argus, "in.c"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_feed(&argus, "--output"), ARGUS_SUCCESS);
+    cr_assert_eq(argus_finish(&argus), ARGUS_ERROR_MISSING_VALUE);
+}
@@ -150,3 +150,60 @@ Test(post_validation, valid_inputs)
     // Clean up
     argus_free(&argus);
 }
+
+// Test that validation only walks the options set by the parse
+Test(post_validation, touched_options_recorded)
+{
+    char *argv[] = {"test_program", "-v", "-v", "-u", "user", "input.txt"};
+    int argc = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(validation_options, "test_program", "1.0.0");
+
+    int status = parse_args(&argus, validation_options, argc - 1, &argv[1]);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Initial parsing should succeed");
+
+    // Repeated occurrences in a row are recorded once
+    cr_assert_eq(argus.touched.count, 3, "Three options should be recorded");
+    cr_assert_eq(argus.touched.options[0], &validation_options[1], "First is --verbose");
+    cr_assert_eq(argus.touched.options[1], &validation_options[3], "Second is --username");
+    cr_assert_eq(argus.touched.options[2], &validation_options[5], "Third is the positional");
+
+    // --username still requires --password
+    status = post_parse_validation(&argus);
+    cr_assert_eq(status, ARGUS_ERROR_MISSING_REQUIRED, "Missing dependency should be reported");
+
+    argus_free(&argus);
+    cr_assert_null(argus.touched.options, "argus_free should release the list");
+}
+
+// Options holding a default are validated even when the parse did not touch them
+Test(post_validation, defaults_still_validated)
+{
+    ARGUS_OPTIONS(
+        default_options,
+        OPTION_INT('n', "count", HELP("Count"), DEFAULT(50), VALIDATOR(V_RANGE(1, 10))),
+        GROUP_START("Mode", FLAGS(FLAG_EXCLUSIVE)),
+            OPTION_FLAG('a', "fast", HELP("Fast mode")),
+            OPTION_INT('b', "level", HELP("Level"), DEFAULT(1)),
+        GROUP_END(),
+    )
+    char *argv[] = {"test_program"};
+
+    argus_t argus = argus_init(default_options, "test_program", "1.0.0");
+    int status = parse_args(&argus, default_options, 0, &argv[1]);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Initial parsing should succeed");
+    cr_assert_eq(argus.touched.count, 0, "No option should be recorded");
+
+    status = post_parse_validation(&argus);
+    cr_assert_eq(status, ARGUS_ERROR_INVALID_RANGE, "Default out of range should be reported");
+    argus_free(&argus);
+
+    char *argv_group[] = {"test_program", "-n", "5", "--fast"};
+    argus = argus_init(default_options, "test_program", "1.0.0");
+    status = parse_args(&argus, default_options, 3, &argv_group[1]);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Initial parsing should succeed");
+
+    status = post_parse_validation(&argus);
+    cr_assert_eq(status, ARGUS_ERROR_EXCLUSIVE_GROUP, "Default member should conflict");
+    argus_free(&argus);
+}
@@ -0,0 +1,190 @@
+#include <criterion/criterion.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "argus.h"
+
+ARGUS_OPTIONS(
+    response_options,
+    HELP_OPTION(),
+    OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+    OPTION_STRING('o', "output", HELP("Output file")),
+    OPTION_ARRAY_STRING('I', "include", HELP("Include paths")),
+    POSITIONAL_MANY_STRING("inputs", HELP("Input files"), FLAGS(FLAG_OPTIONAL)),
+)
+
+// Write a response file and return its path, owned by the caller
+static char *write_response_file(const char *contents)
+{
+    char *path = strdup("/tmp/argus_response_XXXXXX");
+    int   fd   = mkstemp(path);
+
+    cr_assert_neq(fd, -1, "Could not create a temporary file");
+    cr_assert_eq(write(fd, contents, strlen(contents)), (ssize_t)strlen(contents));
+    close(fd);
+    return (path);
+}
+
+static char *at(const char *path)
+{
+    char *arg = malloc(strlen(path) + 2);
+    sprintf(arg, "@%s", path);
+    return (arg);
+}
+
+Test(response_files, expands_arguments)
+{
+    char *path = write_response_file("-v --output out.txt\n-I a -I b\nfirst.c");
+    char *arg  = at(path);
+    char *argv[] = {"test", arg, "last.c"};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 3, argv), ARGUS_SUCCESS);
+    cr_assert(argus_get(&argus, "verbose").as_bool);
+    cr_assert_str_eq(argus_get(&argus, "output").as_string, "out.txt");
+    cr_assert_eq(argus_count(&argus, "include"), 2);
+    cr_assert_str_eq(argus_array_get(&argus, "include", 1).as_string, "b");
+    cr_assert_eq(argus_count(&argus, "inputs"), 2);
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 0).as_string, "first.c");
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 1).as_string, "last.c");
+
+    argus_free(&argus);
+    unlink(path);
+    free(path);
+    free(arg);
+}
+
+Test(response_files, quotes_and_escapes)
+{
+    char *path = write_response_file("'single quoted' \"double \\\"quoted\\\"\" back\\ slash '' '@kept'");
+    char *arg  = at(path);
+    char *argv[] = {"test", arg};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 2, argv), ARGUS_SUCCESS);
+    cr_assert_eq(argus_count(&argus, "inputs"), 5);
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 0).as_string, "single quoted");
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 1).as_string, "double \"quoted\"");
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 2).as_string, "back slash");
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 3).as_string, "");
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 4).as_string, "@kept");
+
+    argus_free(&argus);
+    unlink(path);
+    free(path);
+    free(arg);
+}
+
+Test(response_files, nested_files)
+{
+    char *inner      = write_response_file("-I inner");
+    char *inner_arg  = at(inner);
+    char *outer      = write_response_file(inner_arg);
+    char *outer_arg  = at(outer);
+    char *argv[]     = {"test", "-I", "cli", outer_arg};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 4, argv), ARGUS_SUCCESS);
+    cr_assert_eq(argus_count(&argus, "include"), 2);
+    cr_assert_str_eq(argus_array_get(&argus, "include", 1).as_string, "inner");
+
+    argus_free(&argus);
+    unlink(inner);
+    unlink(outer);
+    free(inner);
+    free(inner_arg);
+    free(outer);
+    free(outer_arg);
+}
+
+Test(response_files, quoted_separator_ends_expansion)
+{
+    char *path = write_response_file("-v \"--\"");
+    char *arg  = at(path);
+    char *argv[] = {"test", arg, "@literal"};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 3, argv), ARGUS_SUCCESS);
+    cr_assert(argus_get(&argus, "verbose").as_bool);
+    cr_assert_eq(argus_count(&argus, "inputs"), 1);
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 0).as_string, "@literal");
+
+    argus_free(&argus);
+    unlink(path);
+    free(path);
+    free(arg);
+}
+
+Test(response_files, recursion_is_limited, .init = cr_redirect_stderr)
+{
+    char *path = write_response_file("");
+    char *arg  = at(path);
+    FILE *file = fopen(path, "w");
+
+    // The file includes itself
+    fputs(arg, file);
+    fclose(file);
+
+    char   *argv[] = {"test", arg};
+    argus_t argus  = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 2, argv), ARGUS_ERROR_INVALID_ARGUMENT);
+
+    unlink(path);
+    free(path);
+    free(arg);
+}
+
+Test(response_files, unterminated_quote, .init = cr_redirect_stderr)
+{
+    char *path = write_response_file("-o \"never closed");
+    char *arg  = at(path);
+    char *argv[] = {"test", arg};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 2, argv), ARGUS_ERROR_INVALID_FORMAT);
+
+    unlink(path);
+    free(path);
+    free(arg);
+}
+
+Test(response_files, disabled_by_default)
+{
+    char *argv[] = {"test", "@not-a-file", "--", "@literal"};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+
+    cr_assert_eq(argus_parse(&argus, 4, argv), ARGUS_SUCCESS);
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 0).as_string, "@not-a-file");
+    argus_free(&argus);
+
+    // Enabled, arguments after "--" are still taken literally
+    argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+    cr_assert_eq(argus_parse(&argus, 3, (char *[]){"test", "--", "@literal"}), ARGUS_SUCCESS);
+    cr_assert_str_eq(argus_array_get(&argus, "inputs", 0).as_string, "@literal");
+    argus_free(&argus);
+}
+
+Test(response_files, missing_file, .init = cr_redirect_stderr)
+{
+    char *argv[] = {"test", "@/nonexistent/argus/response"};
+
+    argus_t argus = argus_init(response_options, "test", "1.0.0");
+    argus_use_response_files(&argus, true);
+
+    cr_assert_eq(argus_parse(&argus, 2, argv), ARGUS_ERROR_INVALID_ARGUMENT);
+}
@@ -163,6 +163,63 @@ Test(validators_integration, choices_validation_failure)
     argus_free(&argus);
 }
 
+enum { MODE_SAFE, MODE_FAST, MODE_PARANOID };
+
+ARGUS_OPTIONS(
+    enum_options,
+    HELP_OPTION(),
+    OPTION_ENUM('m', "mode", HELP("Run mode"), DEFAULT(MODE_SAFE),
+                VALIDATOR(V_CHOICE_ENUM("safe", "fast", "paranoid"))),
+    OPTION_ENUM('z', "zone", HELP("Time zone"),
+                VALIDATOR(V_CHOICE_ENUM("UTC", "Europe/Paris", "Europe/Berlin", "Asia/Tokyo",
+                                        "America/New_York", "America/Los_Angeles",
+                                        "Australia/Sydney", "Africa/Cairo", "UTC"))),
+)
+
+// Test for enum choices
+Test(validators_integration, enum_stores_ordinal)
+{
+    char *argv[] = {"test", "-m", "paranoid", "--zone=Asia/Tokyo"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    argus_t argus = argus_init(enum_options, "test", "1.0.0");
+    int status = argus_parse(&argus, argc, argv);
+
+    cr_assert_eq(status, ARGUS_SUCCESS, "Valid choices should pass validation");
+    cr_assert_eq(argus_get(&argus, "mode").as_int, MODE_PARANOID);
+    cr_assert_eq(argus_get(&argus, "zone").as_int, 3);
+
+    argus_free(&argus);
+}
+
+Test(validators_integration, enum_default_and_first_duplicate)
+{
+    char *argv[] = {"test", "--zone", "UTC"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    argus_t argus = argus_init(enum_options, "test", "1.0.0");
+    int status = argus_parse(&argus, argc, argv);
+
+    cr_assert_eq(status, ARGUS_SUCCESS, "Valid choice should pass validation");
+    cr_assert_eq(argus_get(&argus, "mode").as_int, MODE_SAFE, "Default ordinal should be kept");
+    cr_assert_eq(argus_get(&argus, "zone").as_int, 0, "A repeated choice maps to its first position");
+
+    argus_free(&argus);
+}
+
+Test(validators_integration, enum_validation_failure)
+{
+    char *argv[] = {"test", "-m", "Fast"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    argus_t argus = argus_init(enum_options, "test", "1.0.0");
+    int status = argus_parse(&argus, argc, argv);
+
+    cr_assert_eq(status, ARGUS_ERROR_INVALID_CHOICE, "Unknown choice should fail validation");
+
+    argus_free(&argus);
+}
+
 // Test for regex validation
 Test(validators_integration, regex_validation_success)
 {
@@ -0,0 +1,123 @@
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <stdint.h>
+#include "argus/internal/arena.h"
+#include "argus.h"
+
+Test(arena, alloc_aligned)
+{
+    argus_arena_t *arena = arena_create(0);
+
+    char *a = arena_alloc(arena, 3);
+    char *b = arena_alloc(arena, 5);
+    cr_assert_not_null(a, "Allocation should succeed");
+    cr_assert_eq((uintptr_t)b % _Alignof(max_align_t), 0, "Allocations should be aligned");
+    cr_assert(b > a, "Allocations should be carved out in order");
+    arena_destroy(arena);
+}
+
+Test(arena, grows_past_block)
+{
+    argus_arena_t *arena = arena_create(64);
+
+    char *small = arena_alloc(arena, 48);
+    char *large = arena_alloc(arena, 1000);
+    cr_assert_not_null(large, "Allocations larger than a block should succeed");
+    memset(large, 'x', 1000);
+    memset(small, 'y', 48);
+    cr_assert_eq(large[999], 'x', "Blocks should not overlap");
+    cr_assert_not_null(arena->first->next, "A second block should be chained");
+    arena_destroy(arena);
+}
+
+Test(arena, realloc_in_place)
+{
+    argus_arena_t *arena = arena_create(256);
+
+    int *values = arena_alloc(arena, 4 * sizeof(int));
+    for (int i = 0; i < 4; ++i)
+        values[i] = i;
+
+    int *grown = arena_realloc(arena, values, 4 * sizeof(int), 8 * sizeof(int));
+    cr_assert_eq(grown, values, "The last allocation should grow in place");
+
+    arena_alloc(arena, 8);
+    int *moved = arena_realloc(arena, grown, 8 * sizeof(int), 16 * sizeof(int));
+    cr_assert_neq(moved, grown, "An older allocation should be copied");
+    cr_assert_eq(moved[3], 3, "Content should be copied");
+    arena_destroy(arena);
+}
+
+Test(arena, reset_reuses_blocks)
+{
+    argus_arena_t *arena = arena_create(64);
+
+    char          *first  = arena_alloc(arena, 32);
+    arena_alloc(arena, 200);
+    arena_block_t *second = arena->first->next;
+
+    arena_reset(arena);
+    cr_assert_eq(arena_alloc(arena, 32), first, "Reset should rewind to the first block");
+    arena_alloc(arena, 200);
+    cr_assert_eq(arena->first->next, second, "Reset should keep the other blocks");
+    cr_assert_null(second->next, "No block should be added after a reset");
+    arena_destroy(arena);
+}
+
+Test(arena, strndup)
+{
+    argus_arena_t *arena = arena_create(0);
+
+    char *copy = arena_strndup(arena, "key=value", 3);
+    cr_assert_str_eq(copy, "key", "Copy should stop at the given length");
+    arena_destroy(arena);
+}
+
+ARGUS_OPTIONS(
+    arena_options,
+    OPTION_ARRAY_STRING('t', "tags", HELP("Tags")),
+    OPTION_MAP_STRING('e', "env", HELP("Environment")),
+    OPTION_ARRAY_INT('i', "ids", HELP("Identifiers"), FLAGS(FLAG_UNIQUE)),
+)
+
+Test(arena, parse_into_arena)
+{
+    char *argv[] = {"test", "--tags=a,b,c", "-e", "k=v,k=w", "--ids=1,2,2,3"};
+    int   argc   = sizeof(argv) / sizeof(char *);
+
+    argus_t argus = argus_init(arena_options, "test", "1.0.0");
+    cr_assert_eq(argus_use_arena(&argus, 0), ARGUS_SUCCESS, "Arena should be created");
+    cr_assert_eq(argus_parse(&argus, argc, argv), ARGUS_SUCCESS, "Parsing should succeed");
+
+    cr_assert_str_eq(argus_array_get(&argus, "tags", 2).as_string, "c", "Array value should be set");
+    cr_assert_str_eq(argus_map_get(&argus, "env", "k").as_string, "w", "Last value should win");
+    cr_assert_eq(argus_count(&argus, "ids"), 3, "Duplicates should be dropped");
+    cr_assert_not(argus.options[0].is_allocated, "Arena values are not owned by the option");
+
+    argus_value_t *tags = argus_get(&argus, "tags").as_array;
+    argus_reset(&argus);
+    cr_assert_eq(argus_parse(&argus, argc, argv), ARGUS_SUCCESS, "Parsing should succeed again");
+    cr_assert_eq(argus_get(&argus, "tags").as_array, tags, "Reset should reuse the arena memory");
+    argus_free(&argus);
+    cr_assert_null(argus.arena, "Arena should be released by argus_free");
+}
+
+Test(arena, kept_after_failed_parse)
+{
+    char *bad[]  = {"test", "--tags=a,b", "--bogus"};
+    char *good[] = {"test", "--tags=a,b"};
+
+    argus_t argus = argus_init(arena_options, "test", "1.0.0");
+    cr_assert_eq(argus_use_arena(&argus, 0), ARGUS_SUCCESS, "Arena should be created");
+    argus_arena_t *arena = argus.arena;
+
+    cr_redirect_stderr();
+    cr_assert_neq(argus_parse(&argus, 3, bad), ARGUS_SUCCESS, "Unknown option should fail");
+    cr_assert_eq(argus.arena, arena, "A failed parse should keep the arena");
+
+    argus_reset(&argus);
+    cr_assert_eq(argus_parse(&argus, 2, good), ARGUS_SUCCESS, "Parsing should succeed again");
+    cr_assert_not(argus.options[0].is_allocated, "Values should come from the arena again");
+    argus_free(&argus);
+    cr_assert_null(argus.arena, "Arena should be released by argus_free");
+}
@@ -1,6 +1,7 @@
 #include <criterion/criterion.h>
 #include "argus/internal/utils.h"
 #include "argus/types.h"
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -9,6 +10,9 @@
 extern void sort_int_array(argus_value_t *array, size_t count);
 extern void sort_string_array(argus_value_t *array, size_t count);
 extern size_t make_int_array_unique(argus_value_t *array, size_t count);
+extern size_t make_float_array_unique(argus_value_t *array, size_t count);
+extern size_t make_map_values_unique(argus_pair_t *map, size_t count, argus_valtype_t type,
+                                     bool owned);
 extern void sort_map_by_keys(argus_pair_t *map, size_t count);
 extern void apply_array_flags(argus_option_t *option);
 extern void apply_map_flags(argus_option_t *option);
@@ -35,11 +39,12 @@ void setup_map_option(argus_option_t *option, argus_valtype_t type)
 
 Test(multi_values, adjust_array_size)
 {
+    argus_t        argus = {0};
     argus_option_t option;
     setup_array_option(&option, VALUE_TYPE_ARRAY_INT);
     
     // First call should allocate initial capacity
-    adjust_array_size(&option);
+    adjust_array_size(&argus, &option);
     cr_assert_not_null(option.value.as_array, "Array should be allocated");
     cr_assert_eq(option.value_capacity, MULTI_VALUE_INITIAL_CAPACITY, "Initial capacity should be set");
     
@@ -47,7 +52,7 @@ Test(multi_values, adjust_array_size)
     option.value_count = option.value_capacity;
     
     // Next call should double the capacity
-    adjust_array_size(&option);
+    adjust_array_size(&argus, &option);
     cr_assert_eq(option.value_capacity, MULTI_VALUE_INITIAL_CAPACITY * 2, "Capacity should double");
     
     // Clean up
@@ -56,23 +61,27 @@ Test(multi_values, adjust_array_size)
 
 Test(multi_values, adjust_map_size)
 {
+    argus_t        argus = {0};
     argus_option_t option;
     setup_map_option(&option, VALUE_TYPE_MAP_STRING);
     
     // First call should allocate initial capacity
-    adjust_map_size(&option);
+    adjust_map_size(&argus, &option);
     cr_assert_not_null(option.value.as_map, "Map should be allocated");
+    cr_assert_not_null(option.map_slots, "Key index should be allocated with the map");
     cr_assert_eq(option.value_capacity, MULTI_VALUE_INITIAL_CAPACITY, "Initial capacity should be set");
     
     // Fill the map to capacity
+    memset(option.value.as_map, 0, option.value_capacity * sizeof(argus_pair_t));
     option.value_count = option.value_capacity;
     
     // Next call should double the capacity
-    adjust_map_size(&option);
+    adjust_map_size(&argus, &option);
     cr_assert_eq(option.value_capacity, MULTI_VALUE_INITIAL_CAPACITY * 2, "Capacity should double");
     
     // Clean up
     free(option.value.as_map);
+    free(option.map_slots);
 }
 
 Test(multi_values, sort_int_array)
@@ -140,6 +149,66 @@ Test(multi_values, make_int_array_unique)
     cr_assert_eq(array[3].as_int, 40, "Fourth element should be 40");
 }
 
+// Reference: keep a value unless a kept one is within epsilon
+static size_t naive_float_unique(double *values, size_t count)
+{
+    size_t kept = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        bool duplicate = false;
+        for (size_t j = 0; j < kept && !duplicate; j++)
+            duplicate = fabs(values[i] - values[j]) < 0.0000001;
+        if (!duplicate)
+            values[kept++] = values[i];
+    }
+    return kept;
+}
+
+Test(multi_values, make_float_array_unique_matches_epsilon)
+{
+    // Clusters of values a fraction of epsilon apart, around zero, one and the grid limit
+    const double bases[] = {0.0, 1.0, -3.5, 450359962.7370496, -450359962.7370496, 1e12};
+    argus_value_t array[600];
+    double        expected[600];
+    size_t        count = 0;
+
+    srand(42);
+    for (size_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++) {
+        for (int i = 0; i < 100; i++) {
+            double offset = ((double)rand() / RAND_MAX - 0.5) * 0.000001;
+            expected[count]       = bases[b] + offset;
+            array[count].as_float = expected[count];
+            count++;
+        }
+    }
+
+    size_t expected_count = naive_float_unique(expected, count);
+    size_t new_count      = make_float_array_unique(array, count);
+
+    cr_assert_eq(new_count, expected_count, "Float uniqueness should match the epsilon rule");
+    for (size_t i = 0; i < new_count; i++)
+        cr_assert_eq(array[i].as_float, expected[i], "Element %zu should be the first kept", i);
+}
+
+Test(multi_values, make_map_values_unique_keeps_first)
+{
+    argus_pair_t map[5] = {
+        {.key = "a", .value = {.as_string = "x"}},
+        {.key = "b", .value = {.as_string = "y"}},
+        {.key = "c", .value = {.as_string = "x"}},  // Duplicate value
+        {.key = "d", .value = {.as_string = NULL}},
+        {.key = "e", .value = {.as_string = NULL}},  // NULL values are never duplicates
+    };
+
+    size_t new_count = make_map_values_unique(map, 5, VALUE_TYPE_MAP_STRING, false);
+
+    cr_assert_eq(new_count, 4, "Only the repeated value should be dropped");
+    cr_assert_str_eq(map[0].key, "a", "First occurrence should be kept");
+    cr_assert_str_eq(map[1].key, "b", "Order should be preserved");
+    cr_assert_str_eq(map[2].key, "d", "Later pairs should move up");
+    cr_assert_str_eq(map[3].key, "e", "NULL values should be kept");
+}
+
 Test(multi_values, apply_array_flags)
 {
     argus_option_t option;
@@ -258,6 +327,53 @@ Test(multi_values, map_find_key)
     free(option.value.as_map);
 }
 
+Test(multi_values, map_find_key_indexed)
+{
+    argus_t        argus = {0};
+    argus_option_t option;
+    char           key[16];
+    setup_map_option(&option, VALUE_TYPE_MAP_INT);
+    option.flags = FLAG_SORTED_KEY;
+
+    // Insert keys in descending order, the index grows with the map
+    for (int i = 999; i >= 0; --i) {
+        snprintf(key, sizeof(key), "key%03d", i);
+        adjust_map_size(&argus, &option);
+        option.value.as_map[option.value_count].key          = strdup(key);
+        option.value.as_map[option.value_count].value.as_int = i;
+        option.value_count++;
+        map_index_add(&option, option.value_count - 1);
+    }
+    cr_assert_not_null(option.map_slots, "Key index should be allocated");
+
+    int index = map_find_key(&option, "key999");
+    cr_assert_eq(index, 0, "Keys should keep their insertion position");
+    index = map_find_key(&option, "key000");
+    cr_assert_eq(index, 999, "Last key should be at the last position");
+    index = map_find_key(&option, "key1000");
+    cr_assert_eq(index, -1, "Nonexistent key should return -1");
+
+    // Sorting moves the pairs, the index has to follow
+    apply_map_flags(&option);
+    for (int i = 0; i < 1000; i += 111) {
+        snprintf(key, sizeof(key), "key%03d", i);
+        index = map_find_key(&option, key);
+        cr_assert_eq(index, i, "Key '%s' should be found at its sorted position", key);
+        cr_assert_eq(option.value.as_map[index].value.as_int, i, "Key should keep its value");
+    }
+
+    // Cleared maps keep an empty index
+    for (size_t i = 0; i < option.value_count; i++)
+        free((void *)option.value.as_map[i].key);
+    option.value_count = 0;
+    clear_multi_values(&option);
+    index = map_find_key(&option, "key000");
+    cr_assert_eq(index, -1, "Cleared map should not find old keys");
+
+    free_option_value(&option);
+    cr_assert_null(option.map_slots, "Key index should be released with the map");
+}
+
 Test(multi_values, sort_map_by_keys)
 {
     argus_option_t option;
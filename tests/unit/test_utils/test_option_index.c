@@ -0,0 +1,203 @@
+#include <criterion/criterion.h>
+#include "argus/internal/option_index.h"
+#include "argus/internal/utils.h"
+#include "argus.h"
+
+ARGUS_OPTIONS(
+    index_sub_options,
+    OPTION_FLAG('d', "debug", HELP("Debug mode")),
+    OPTION_STRING('\0', "target", HELP("Target")),
+)
+
+ARGUS_OPTIONS(
+    index_options,
+    OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+    OPTION_STRING('o', "output", HELP("Output file")),
+    OPTION_STRING('s', NULL, HELP("Short-only option")),
+    OPTION_FLAG('\0', "long-only", HELP("Long-only option")),
+    SUBCOMMAND("run", index_sub_options, HELP("Run something")),
+)
+
+Test(option_index, build_counts_options)
+{
+    argus_index_t *index = index_build(index_options);
+
+    cr_assert_not_null(index, "Index should be built");
+    cr_assert_eq(index->options, index_options, "Index should reference its options");
+    cr_assert_eq(index->count, 5, "Index should count every entry before OPTION_END");
+    index_free(index);
+}
+
+Test(option_index, find_lname)
+{
+    argus_index_t *index = index_build(index_options);
+
+    argus_option_t *option = index_find_lname(index, "verbose", 7);
+    cr_assert_not_null(option, "Should find option by long name");
+    cr_assert_eq(option->sname, 'v', "Found option should have correct short name");
+
+    option = index_find_lname(index, "long-only", 9);
+    cr_assert_not_null(option, "Should find long-only option");
+
+    option = index_find_lname(index, "nonexistent", 11);
+    cr_assert_null(option, "Should return NULL for nonexistent long name");
+
+    option = index_find_lname(index, "run", 3);
+    cr_assert_null(option, "Subcommands should not be found as long options");
+    index_free(index);
+}
+
+Test(option_index, find_lname_prefix_span)
+{
+    argus_index_t *index = index_build(index_options);
+
+    // "--output=file" is looked up with the length of the name part only
+    argus_option_t *option = index_find_lname(index, "output=file", 6);
+    cr_assert_not_null(option, "Should find option from a name span");
+    cr_assert_str_eq(option->name, "output", "Found option should be 'output'");
+
+    option = index_find_lname(index, "verb", 4);
+    cr_assert_null(option, "A prefix should not match a long name");
+    index_free(index);
+}
+
+Test(option_index, find_sname)
+{
+    argus_index_t *index = index_build(index_options);
+
+    argus_option_t *option = index_find_sname(index, 'v');
+    cr_assert_not_null(option, "Should find option by short name");
+    cr_assert_str_eq(option->name, "verbose", "Found option should have correct name");
+
+    option = index_find_sname(index, 's');
+    cr_assert_not_null(option, "Should find short-only option");
+    cr_assert_null(option->lname, "Found option should have no long name");
+
+    cr_assert_null(index_find_sname(index, 'x'), "Should return NULL for unknown short name");
+    cr_assert_null(index_find_sname(index, '\0'), "NUL should never match an option");
+    cr_assert_null(index_find_sname(index, (char)0xE9), "High bytes should be looked up safely");
+    index_free(index);
+}
+
+Test(option_index, find_positional)
+{
+    argus_option_t options[] = {
+        OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+        POSITIONAL_STRING("first", HELP("First")),
+        OPTION_STRING('o', "output", HELP("Output file")),
+        POSITIONAL_INT("second", HELP("Second")),
+        POSITIONAL_MANY_STRING("rest", HELP("Rest")),
+        OPTION_END(),
+    };
+    argus_index_t *index = index_build(options);
+
+    cr_assert_eq(index->positional_count, 2, "Fixed positionals should be counted");
+    cr_assert_eq(index_find_positional(index, 0), &options[1], "Position 0 is 'first'");
+    cr_assert_eq(index_find_positional(index, 1), &options[3], "Position 1 is 'second'");
+    cr_assert_eq(index_find_positional(index, 2), &options[4], "Position 2 is the variadic");
+    cr_assert_eq(index_find_positional(index, 1000), &options[4], "Later positions stay variadic");
+    cr_assert_eq(index_find_positional(index, 1), find_positional(options, 1),
+                 "Index should agree with the linear lookup");
+    index_free(index);
+
+    index = index_build(index_options);
+    cr_assert_null(index_find_positional(index, 0), "No positional should be found");
+    index_free(index);
+}
+
+Test(option_index, short_cluster_uses_index)
+{
+    char   *argv[] = {"test", "-vso"};
+    argus_t argus  = argus_init(index_options, "test", "1.0.0");
+
+    int status = argus_parse(&argus, 2, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing a cluster should succeed");
+    cr_assert(argus_is_set(&argus, "verbose"), "Flag should be set from the cluster");
+    cr_assert_str_eq(argus_get(&argus, "s").as_string, "o", "Short option takes the rest as value");
+    argus_free(&argus);
+}
+
+Test(option_index, built_at_init_and_on_subcommand)
+{
+    char   *argv[] = {"test", "--verbose", "run", "--target=x", "--debug"};
+    argus_t argus  = argus_init(index_options, "test", "1.0.0");
+
+    cr_assert_not_null(argus.indexes[0], "Root index should be built at init");
+    cr_assert_eq(argus.indexes[0]->options, index_options, "Root index should match options");
+
+    int status = argus_parse(&argus, 5, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing should succeed");
+    cr_assert_not_null(argus.indexes[1], "Subcommand index should be built when entered");
+    cr_assert_eq(argus.indexes[1]->options, index_sub_options, "Index should match sub options");
+    cr_assert_str_eq(argus_get(&argus, "target").as_string, "x", "Value should be set");
+    cr_assert(argus_is_set(&argus, "debug"), "Flag should be set");
+
+    argus_free(&argus);
+    cr_assert_null(argus.indexes[0], "Indexes should be released by argus_free");
+    cr_assert_null(argus.indexes[1], "Indexes should be released by argus_free");
+}
+
+Test(option_index, lookup_without_index)
+{
+    argus_t argus = {.program_name = "test", .options = index_options};
+
+    argus_option_t *option = find_long_option(&argus, index_options, "output", 6);
+    cr_assert_not_null(option, "Lookup should fall back to a scan without an index");
+    cr_assert_eq(option->sname, 'o', "Found option should have correct short name");
+}
+
+Test(option_index, choice_tables_built_for_enum_options)
+{
+    // Validators are not constant initializers for every compiler, keep them local
+    ARGUS_OPTIONS(
+        enum_options,
+        OPTION_ENUM('c', "color", HELP("Color"), VALIDATOR(V_CHOICE_ENUM("red", "green", "blue"))),
+    )
+    ARGUS_OPTIONS(
+        enum_root,
+        OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+        SUBCOMMAND("paint", enum_options, HELP("Paint something")),
+    )
+
+    char   *argv[] = {"test", "paint", "--color=blue"};
+    argus_t argus  = argus_init(enum_root, "test", "1.0.0");
+
+    cr_assert_null(argus.indexes[0]->choice_tables, "Levels without enums have no choice tables");
+
+    int status = argus_parse(&argus, 3, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Parsing should succeed");
+    cr_assert_eq(argus_get(&argus, "paint.color").as_int, 2, "Value should be the ordinal");
+
+    const choice_table_t *table = index_find_choices(&argus, &enum_options[0]);
+    cr_assert_not_null(table, "Enum option should have a choice table");
+    cr_assert_eq(choice_table_find(table, "red"), 0, "First choice should be ordinal 0");
+    cr_assert_eq(choice_table_find(table, "green"), 1, "Second choice should be ordinal 1");
+    cr_assert_eq(choice_table_find(table, "purple"), -1, "Unknown value should not be found");
+
+    argus_free(&argus);
+}
+
+ARGUS_OPTIONS(
+    index_dependency_options,
+    OPTION_FLAG('a', "alpha", HELP("Alpha"), REQUIRE("gamma", "missing")),
+    OPTION_FLAG('b', "beta", HELP("Beta"), CONFLICT("alpha")),
+    OPTION_FLAG('c', "gamma", HELP("Gamma")),
+    GROUP_START("Format", FLAGS(FLAG_EXCLUSIVE)),
+    OPTION_FLAG('j', "json", HELP("JSON")),
+    OPTION_FLAG('x', "xml", HELP("XML")),
+    GROUP_END(),
+)
+
+Test(option_index, dependency_masks)
+{
+    argus_index_t *index = index_build(index_dependency_options);
+
+    cr_assert_eq(index->dependency_words, 1, "Seven options fit in one word");
+    cr_assert_eq(index->require_masks[0][0], 1u << 2, "Unknown names should be ignored");
+    cr_assert_null(index->require_masks[1], "Options without REQUIRE have no mask");
+    cr_assert_eq(index->conflict_masks[1][0], 1u << 0, "CONFLICT should resolve to positions");
+    cr_assert_eq(index->group_masks[3][0], (1u << 4) | (1u << 5),
+                 "Exclusive group should hold its members up to GROUP_END");
+    cr_assert_null(index->group_masks[6], "GROUP_END is not an exclusive group");
+    index_free(index);
+}
@@ -0,0 +1,168 @@
+#include <criterion/criterion.h>
+#include "argus/internal/sort.h"
+#include "argus/types.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The kernels must order like the qsort comparators they replace
+static int compare_ints(const void *a, const void *b)
+{
+    int ia = ((const argus_value_t *)a)->as_int;
+    int ib = ((const argus_value_t *)b)->as_int;
+    return (ia > ib) - (ia < ib);
+}
+
+static int compare_floats(const void *a, const void *b)
+{
+    double fa = ((const argus_value_t *)a)->as_float;
+    double fb = ((const argus_value_t *)b)->as_float;
+    return (fa > fb) - (fa < fb);
+}
+
+static int compare_strings(const void *a, const void *b)
+{
+    const char *sa = ((const argus_value_t *)a)->as_string;
+    const char *sb = ((const argus_value_t *)b)->as_string;
+    if (sa == NULL || sb == NULL)
+        return (sb == NULL) - (sa == NULL);
+    return strcmp(sa, sb);
+}
+
+#define COUNT 1000
+
+Test(sort, small_collections_left_to_qsort)
+{
+    argus_value_t array[SORT_KERNEL_THRESHOLD - 1] = {0};
+
+    cr_assert_not(sort_values(array, SORT_KERNEL_THRESHOLD - 1, sizeof(argus_value_t), 0,
+                              SORT_KEY_INT),
+                  "Collections below the threshold should not be sorted by a kernel");
+}
+
+Test(sort, ints_match_qsort)
+{
+    argus_value_t *array    = calloc(COUNT, sizeof(argus_value_t));
+    argus_value_t *expected = calloc(COUNT, sizeof(argus_value_t));
+
+    srand(1);
+    for (size_t i = 0; i < COUNT; i++) {
+        int value = rand() - RAND_MAX / 2;
+        if (i % 10 == 0)
+            value = (int)(i % 7) - 3;  // Small values share their upper bytes
+        array[i].as_int64 = value;
+        expected[i]       = array[i];
+    }
+    expected[0].as_int = INT32_MIN;
+    array[0].as_int    = INT32_MIN;
+    expected[1].as_int = INT32_MAX;
+    array[1].as_int    = INT32_MAX;
+
+    qsort(expected, COUNT, sizeof(argus_value_t), compare_ints);
+    cr_assert(sort_values(array, COUNT, sizeof(argus_value_t), 0, SORT_KEY_INT),
+              "Ints should be radix sorted");
+    for (size_t i = 0; i < COUNT; i++)
+        cr_assert_eq(array[i].as_int, expected[i].as_int, "Element %zu should match qsort", i);
+
+    free(array);
+    free(expected);
+}
+
+Test(sort, floats_match_qsort)
+{
+    argus_value_t *array    = calloc(COUNT, sizeof(argus_value_t));
+    argus_value_t *expected = calloc(COUNT, sizeof(argus_value_t));
+
+    srand(2);
+    for (size_t i = 0; i < COUNT; i++) {
+        double value = ((double)rand() / RAND_MAX - 0.5) * pow(10, (int)(i % 20) - 10);
+        array[i].as_float = value;
+        expected[i]       = array[i];
+    }
+    array[0].as_float = expected[0].as_float = -INFINITY;
+    array[1].as_float = expected[1].as_float = INFINITY;
+    array[2].as_float = expected[2].as_float = 0.0;
+
+    qsort(expected, COUNT, sizeof(argus_value_t), compare_floats);
+    cr_assert(sort_values(array, COUNT, sizeof(argus_value_t), 0, SORT_KEY_FLOAT),
+              "Floats should be radix sorted");
+    for (size_t i = 0; i < COUNT; i++)
+        cr_assert_eq(array[i].as_float, expected[i].as_float, "Element %zu should match qsort", i);
+
+    free(array);
+    free(expected);
+}
+
+Test(sort, strings_match_qsort)
+{
+    argus_value_t *array    = calloc(COUNT, sizeof(argus_value_t));
+    argus_value_t *expected = calloc(COUNT, sizeof(argus_value_t));
+    char (*storage)[32]     = calloc(COUNT, 32);
+
+    srand(3);
+    for (size_t i = 0; i < COUNT; i++) {
+        // Long shared prefixes, repeated values, empty strings and high bytes
+        snprintf(storage[i], 32, "%s%d%c", i % 3 ? "common/prefix/" : "", rand() % 200,
+                 i % 5 ? 'a' : (char)0xE9);
+        if (i % 97 == 0)
+            storage[i][0] = '\0';
+        array[i].as_string = (i % 101 == 0) ? NULL : storage[i];
+        expected[i]        = array[i];
+    }
+
+    qsort(expected, COUNT, sizeof(argus_value_t), compare_strings);
+    cr_assert(sort_values(array, COUNT, sizeof(argus_value_t), 0, SORT_KEY_STRING),
+              "Strings should be sorted by the multikey quicksort");
+    for (size_t i = 0; i < COUNT; i++) {
+        if (expected[i].as_string == NULL)
+            cr_assert_null(array[i].as_string, "NULL strings should come first");
+        else
+            cr_assert_str_eq(array[i].as_string, expected[i].as_string,
+                             "Element %zu should match qsort", i);
+    }
+
+    free(array);
+    free(expected);
+    free(storage);
+}
+
+Test(sort, map_pairs_move_with_their_key)
+{
+    argus_pair_t *map = calloc(COUNT, sizeof(argus_pair_t));
+    char (*keys)[16]  = calloc(COUNT, 16);
+
+    for (size_t i = 0; i < COUNT; i++) {
+        snprintf(keys[i], 16, "key%zu", i);
+        map[i].key          = keys[i];
+        map[i].value.as_int = (int)((i * 7919) % COUNT);
+    }
+
+    cr_assert(sort_values(map, COUNT, sizeof(argus_pair_t), offsetof(argus_pair_t, value),
+                          SORT_KEY_INT),
+              "Pairs should be sorted by value");
+    for (size_t i = 0; i < COUNT; i++) {
+        cr_assert_eq(map[i].value.as_int, (int)i, "Values should be in order");
+        size_t origin = strtoul(map[i].key + 3, NULL, 10);
+        cr_assert_eq((origin * 7919) % COUNT, i, "Keys should follow their value");
+    }
+
+    free(map);
+    free(keys);
+}
+
+Test(sort, bools_false_first)
+{
+    argus_pair_t map[SORT_KERNEL_THRESHOLD * 2];
+
+    for (size_t i = 0; i < SORT_KERNEL_THRESHOLD * 2; i++) {
+        map[i].key           = NULL;
+        map[i].value.raw     = 0;
+        map[i].value.as_bool = (i % 3 == 0);
+    }
+
+    cr_assert(sort_values(map, SORT_KERNEL_THRESHOLD * 2, sizeof(argus_pair_t),
+                          offsetof(argus_pair_t, value), SORT_KEY_BOOL),
+              "Bools should be sorted");
+    for (size_t i = 1; i < SORT_KERNEL_THRESHOLD * 2; i++)
+        cr_assert(map[i - 1].value.as_bool <= map[i].value.as_bool, "false should come first");
+}
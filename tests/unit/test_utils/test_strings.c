@@ -109,3 +109,17 @@ Test(strings, split_multiple_separators)
     
     free_split(result);
 }
+
+Test(strings, split_next_in_place)
+{
+    char  buffer[] = ",one,,two,";
+    char *cursor   = buffer;
+
+    char *first = split_next(&cursor, ",");
+    cr_assert_eq(first, buffer + 1, "Word should point into the buffer");
+    cr_assert_str_eq(first, "one", "First word should be 'one'");
+    char *second = split_next(&cursor, ",");
+    cr_assert_str_eq(second, "two", "Empty words should be skipped");
+    cr_assert_null(split_next(&cursor, ","), "No word should be left");
+    cr_assert_null(split_next(&cursor, ","), "Exhausted cursor should stay at the end");
+}
@@ -0,0 +1,154 @@
+#include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include "argus/internal/option_index.h"
+#include "argus/internal/parsing.h"
+#include "argus/internal/subcommand_trie.h"
+#include "argus.h"
+
+ARGUS_OPTIONS(
+    trie_sub_options,
+    OPTION_FLAG('d', "debug", HELP("Debug mode")),
+)
+
+ARGUS_OPTIONS(
+    trie_options,
+    OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+    SUBCOMMAND("install", trie_sub_options, HELP("Install packages")),
+    SUBCOMMAND("init", trie_sub_options, HELP("Initialize project")),
+    SUBCOMMAND("status", trie_sub_options, HELP("Show status")),
+    SUBCOMMAND("addon", trie_sub_options, HELP("Manage addons")),
+    SUBCOMMAND("add", trie_sub_options, HELP("Add a package")),
+)
+
+ARGUS_OPTIONS(
+    trie_flat_options,
+    OPTION_FLAG('v', "verbose", HELP("Verbose output")),
+)
+
+Test(subcommand_trie, exact_match)
+{
+    subcommand_trie_t *trie = subcommand_trie_build(trie_options);
+    subcommand_match_t match;
+
+    cr_assert_not_null(trie, "Trie should be built");
+    subcommand_trie_match(trie, "install", &match);
+    cr_assert_eq(match.count, 1, "Exact match should designate one subcommand");
+    cr_assert_eq(match.option, &trie_options[1], "Should find 'install'");
+
+    subcommand_trie_match(trie, "status", &match);
+    cr_assert_eq(match.option, &trie_options[3], "Should find 'status'");
+    subcommand_trie_free(trie);
+}
+
+Test(subcommand_trie, duplicate_keeps_first)
+{
+    argus_option_t options[] = {
+        SUBCOMMAND("run", trie_sub_options, HELP("First run")),
+        SUBCOMMAND("run", trie_sub_options, HELP("Second run")),
+        OPTION_END(),
+    };
+    subcommand_trie_t *trie = subcommand_trie_build(options);
+    subcommand_match_t match;
+
+    subcommand_trie_match(trie, "r", &match);
+    cr_assert_eq(match.count, 1, "Duplicate name should be inserted once");
+    cr_assert_eq(match.option, &options[0], "First declaration should win");
+    subcommand_trie_free(trie);
+}
+
+Test(subcommand_trie, exact_match_wins_over_prefix)
+{
+    subcommand_trie_t *trie = subcommand_trie_build(trie_options);
+    subcommand_match_t match;
+
+    // "add" is also a prefix of "addon", which is declared first
+    subcommand_trie_match(trie, "add", &match);
+    cr_assert_eq(match.count, 1, "Exact name should not be ambiguous");
+    cr_assert_str_eq(match.option->name, "add", "Should find 'add'");
+
+    subcommand_trie_match(trie, "addo", &match);
+    cr_assert_str_eq(match.option->name, "addon", "Unique prefix should find 'addon'");
+    subcommand_trie_free(trie);
+}
+
+Test(subcommand_trie, unique_prefix)
+{
+    subcommand_trie_t *trie = subcommand_trie_build(trie_options);
+    subcommand_match_t match;
+
+    subcommand_trie_match(trie, "ins", &match);
+    cr_assert_eq(match.count, 1, "Unique prefix should designate one subcommand");
+    cr_assert_str_eq(match.option->name, "install", "Should find 'install'");
+
+    subcommand_trie_match(trie, "s", &match);
+    cr_assert_str_eq(match.option->name, "status", "Should find 'status'");
+    subcommand_trie_free(trie);
+}
+
+Test(subcommand_trie, no_match)
+{
+    subcommand_trie_t *trie = subcommand_trie_build(trie_options);
+    subcommand_match_t match;
+
+    subcommand_trie_match(trie, "installer", &match);
+    cr_assert_eq(match.count, 0, "Longer token should not match");
+    cr_assert_null(match.option, "No option should be returned");
+
+    subcommand_trie_match(trie, "ix", &match);
+    cr_assert_eq(match.count, 0, "Diverging token should not match");
+    subcommand_trie_free(trie);
+
+    trie = subcommand_trie_build(trie_flat_options);
+    subcommand_trie_match(trie, "anything", &match);
+    cr_assert_eq(match.count, 0, "Level without subcommands should not match");
+    subcommand_trie_free(trie);
+}
+
+Test(subcommand_trie, ambiguous_candidates)
+{
+    subcommand_trie_t *trie = subcommand_trie_build(trie_options);
+    subcommand_match_t match;
+    argus_option_t    *candidates[8];
+
+    subcommand_trie_match(trie, "i", &match);
+    cr_assert_eq(match.count, 2, "'i' should designate 'install' and 'init'");
+    cr_assert_null(match.option, "Ambiguous prefix should not return an option");
+
+    size_t count = subcommand_trie_candidates(trie, &match, candidates, 8);
+    cr_assert_eq(count, 2, "Both candidates should be listed");
+    cr_assert_str_eq(candidates[0]->name, "install", "Candidates keep declaration order");
+    cr_assert_str_eq(candidates[1]->name, "init", "Candidates keep declaration order");
+
+    subcommand_trie_match(trie, "ad", &match);
+    count = subcommand_trie_candidates(trie, &match, candidates, 8);
+    cr_assert_eq(count, 2, "'ad' should designate 'addon' and 'add'");
+    cr_assert_str_eq(candidates[0]->name, "addon", "Candidates keep declaration order");
+    cr_assert_str_eq(candidates[1]->name, "add", "Candidates keep declaration order");
+    subcommand_trie_free(trie);
+}
+
+Test(subcommand_trie, built_lazily)
+{
+    char   *argv[] = {"test", "sta", "--debug"};
+    argus_t argus  = argus_init(trie_options, "test", "1.0.0");
+
+    cr_assert_null(argus.indexes[0]->subcommands, "Trie should not be built at init");
+
+    int status = argus_parse(&argus, 3, argv);
+    cr_assert_eq(status, ARGUS_SUCCESS, "Unique prefix should be accepted");
+    cr_assert_not_null(argus.indexes[0]->subcommands, "Trie should be built on first use");
+    cr_assert(argus_has_command(&argus), "Subcommand should be selected");
+    cr_assert_str_eq(argus.subcommand_stack[0]->name, "status", "Should select 'status'");
+    argus_free(&argus);
+}
+
+Test(subcommand_trie, ambiguous_error_lists_candidates, .init = cr_redirect_stderr)
+{
+    argus_t         argus  = {.program_name = "test", .options = trie_options};
+    argus_option_t *option = NULL;
+
+    int status = find_subcommand(&argus, trie_options, "in", &option);
+    cr_assert_eq(status, ARGUS_ERROR_AMBIGUOUS_SUBCOMMAND, "'in' should be ambiguous");
+    cr_assert_eq(argus.error_code, ARGUS_ERROR_AMBIGUOUS_SUBCOMMAND, "Error should be reported");
+    cr_assert_null(option, "No subcommand should be selected");
+}